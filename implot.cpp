@@ -65,6 +65,8 @@ You can read releases logs https://github.com/epezent/implot/releases for more d
 #include "implot.h"
 #include "implot_internal.h"
 
+#include <chrono>
+
 #ifdef _MSC_VER
 #define sprintf sprintf_s
 #endif
@@ -72,6 +74,11 @@ You can read releases logs https://github.com/epezent/implot/releases for more d
 // Global plot context
 ImPlotContext* GImPlot = NULL;
 
+// Global profiler callbacks (see SetProfilerCallbacks)
+static ImPlotProfilerCallback GImPlotProfileBegin    = NULL;
+static ImPlotProfilerCallback GImPlotProfileEnd      = NULL;
+static void*                  GImPlotProfileUserData = NULL;
+
 //-----------------------------------------------------------------------------
 // Struct Implementations
 //-----------------------------------------------------------------------------
@@ -81,6 +88,37 @@ ImPlotRange::ImPlotRange() {
     Max = NAN;
 }
 
+ImPlotQuerySummary::ImPlotQuerySummary() {
+    Count = 0;
+    Min = Max = Mean = ImPlotPoint(NAN, NAN);
+}
+
+void ImPlotDigitalChannel::AddTransition(double time, float state) {
+    IM_ASSERT_USER_ERROR(Times.Size == 0 || time >= Times.back(), "Digital channel transitions must be added in ascending order!");
+    if (Times.Size == 0)
+        EndTime = time;
+    if (States.Size == 0 || States.back() != state) {
+        Times.push_back(time);
+        States.push_back(state);
+    }
+    Extend(time);
+}
+
+template <typename T>
+static void BuildDigitalChannel(ImPlotDigitalChannel& channel, const T* xs, const T* ys, int count, int offset, int stride) {
+    channel.Clear();
+    for (int i = 0; i < count; ++i)
+        channel.AddTransition((double)ImPlot::OffsetAndStride(xs, i, count, offset, stride), (float)ImPlot::OffsetAndStride(ys, i, count, offset, stride));
+}
+
+void ImPlotDigitalChannel::Build(const float* xs, const float* ys, int count, int offset, int stride) {
+    BuildDigitalChannel(*this, xs, ys, count, offset, stride);
+}
+
+void ImPlotDigitalChannel::Build(const double* xs, const double* ys, int count, int offset, int stride) {
+    BuildDigitalChannel(*this, xs, ys, count, offset, stride);
+}
+
 ImPlotInputMap::ImPlotInputMap() {
     PanButton             = ImGuiMouseButton_Left;
     PanMod                = ImGuiKeyModFlags_None;
@@ -99,6 +137,7 @@ ImPlotInputMap::ImPlotInputMap() {
 ImPlotStyle::ImPlotStyle() {
 
     LineWeight       = 1;
+    LineJoin         = ImPlotLineJoin_None;
     Marker           = ImPlotMarker_None;
     MarkerSize       = 4;
     MarkerWeight     = 1;
@@ -218,6 +257,7 @@ struct ImPlotStyleVarInfo {
 static const ImPlotStyleVarInfo GPlotStyleVarInfo[] =
 {
     { ImGuiDataType_Float, 1, (ImU32)IM_OFFSETOF(ImPlotStyle, LineWeight)       }, // ImPlotStyleVar_LineWeight
+    { ImGuiDataType_S32,   1, (ImU32)IM_OFFSETOF(ImPlotStyle, LineJoin)         }, // ImPlotStyleVar_LineJoin
     { ImGuiDataType_S32,   1, (ImU32)IM_OFFSETOF(ImPlotStyle, Marker)           }, // ImPlotStyleVar_Marker
     { ImGuiDataType_Float, 1, (ImU32)IM_OFFSETOF(ImPlotStyle, MarkerSize)       }, // ImPlotStyleVar_MarkerSize
     { ImGuiDataType_Float, 1, (ImU32)IM_OFFSETOF(ImPlotStyle, MarkerWeight)     }, // ImPlotStyleVar_MarkerWeight
@@ -311,6 +351,74 @@ double NiceNum(double x, bool round) {
     return nf * ImPow(10.0, expv);
 }
 
+double GetPerfTimeMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+void BeginMetricsCapture(ImPlotMetricsCapture& capture, const ImDrawList& draw_list) {
+    capture.Active = MetricsEnabled();
+    if (!capture.Active)
+        return;
+    capture.StartMs  = GetPerfTimeMs();
+    capture.StartVtx = draw_list.VtxBuffer.Size;
+    capture.StartIdx = draw_list.IdxBuffer.Size;
+    capture.StartCmd = draw_list.CmdBuffer.Size;
+}
+
+void EndMetricsCapture(const ImPlotMetricsCapture& capture, const ImDrawList& draw_list, ImPlotMetrics& metrics) {
+    if (!capture.Active)
+        return;
+    metrics.TimeMs    += (float)(GetPerfTimeMs() - capture.StartMs);
+    metrics.Vertices  += draw_list.VtxBuffer.Size - capture.StartVtx;
+    metrics.Indices   += draw_list.IdxBuffer.Size - capture.StartIdx;
+    metrics.CmdSplits += draw_list.CmdBuffer.Size - capture.StartCmd;
+}
+
+ImVec2 CalcTextSizeCached(const char* text, const char* text_end, bool hide_text_after_double_hash) {
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    if (text_end == text)
+        return ImGui::CalcTextSize(text, text_end, hide_text_after_double_hash);
+    ImGuiContext& G = *GImGui;
+    ImPlotTextSizeCache& cache = GImPlot->TextSizeCache;
+    ImGuiID key = ImHashStr(text, (size_t)(text_end - text), hide_text_after_double_hash ? 1 : 0);
+    key = ImHashData(&G.Font, sizeof(G.Font), key);
+    key = ImHashData(&G.FontSize, sizeof(G.FontSize), key);
+    int idx = cache.Map.GetInt(key, -1);
+    if (idx != -1) {
+        cache.Hits++;
+        if (idx != cache.Head) {
+            cache.Unlink(idx);
+            cache.PushFront(idx);
+        }
+        return cache.Entries[idx].Size;
+    }
+    cache.Misses++;
+    if (cache.Entries.Size < cache.Capacity) {
+        idx = cache.Entries.Size;
+        cache.Entries.push_back(ImPlotTextSizeCache::Entry());
+    }
+    else {
+        // evict the least recently used entry
+        idx = cache.Tail;
+        cache.Unlink(idx);
+        cache.Map.SetInt(cache.Entries[idx].Key, -1);
+    }
+    ImPlotTextSizeCache::Entry& entry = cache.Entries[idx];
+    entry.Key  = key;
+    entry.Size = ImGui::CalcTextSize(text, text_end, hide_text_after_double_hash);
+    cache.PushFront(idx);
+    cache.Map.SetInt(key, idx);
+    // ImGuiStorage can't erase, so rebuild the map once evicted keys dominate it
+    if (cache.Map.Data.Size > 2 * cache.Capacity) {
+        cache.Map.Clear();
+        for (int i = 0; i < cache.Entries.Size; ++i)
+            cache.Map.SetInt(cache.Entries[i].Key, i);
+    }
+    return entry.Size;
+}
+
 //-----------------------------------------------------------------------------
 // Context Utils
 //-----------------------------------------------------------------------------
@@ -341,7 +449,10 @@ void SetCurrentContext(ImPlotContext* ctx) {
 
 void Initialize(ImPlotContext* ctx) {
     Reset(ctx);
+    ctx->CurrentSubplot = NULL;
     ctx->Colormap = GetColormap(ImPlotColormap_Default, &ctx->ColormapSize);
+    ctx->MetricsFrame   = -1;
+    ctx->MetricsShowVtx = false;
 }
 
 void Reset(ImPlotContext* ctx) {
@@ -375,6 +486,8 @@ void Reset(ImPlotContext* ctx) {
     // reset digital plot items count
     ctx->DigitalPlotItemCnt = 0;
     ctx->DigitalPlotOffset = 0;
+    // release transient scratch memory
+    ctx->FrameArena.Reset();
     // nullify plot
     ctx->CurrentPlot = NULL;
     ctx->CurrentItem = NULL;
@@ -398,6 +511,102 @@ void BustPlotCache() {
     GImPlot->Plots.Clear();
 }
 
+void CompactPoolMap(ImGuiStorage& map) {
+    int n = 0;
+    for (int i = 0; i < map.Data.Size; ++i) {
+        if (map.Data[i].val_i != -1)
+            map.Data[n++] = map.Data[i];
+    }
+    map.Data.shrink(n);
+}
+
+// Removes entries of #pool other than #keep that have outlived the garbage collection age, returns the number evicted
+template <typename T>
+static int CollectPoolGarbage(ImPool<T>& pool, const T* keep, int* live_out) {
+    ImPlotContext& gp = *GImPlot;
+    int live    = 0;
+    int evicted = 0;
+    for (int i = 0; i < pool.Map.Data.Size; ++i) {
+        const int idx = pool.Map.Data[i].val_i;
+        if (idx == -1)
+            continue;
+        T* entry = pool.GetByIndex(idx);
+        if (entry != keep && gp.Gc.Expired(entry->LastFrameSeen, entry->LastTimeSeen)) {
+            pool.Remove(pool.Map.Data[i].key, idx);
+            evicted++;
+        }
+        else {
+            live++;
+        }
+    }
+    if (evicted > 0)
+        CompactPoolMap(pool.Map);
+    if (live_out != NULL)
+        *live_out = live;
+    return evicted;
+}
+
+void CollectPlotGarbage() {
+    ImPlotContext& gp = *GImPlot;
+    const int frame = ImGui::GetFrameCount();
+    if (gp.Gc.LastFrame == frame)
+        return;
+    gp.Gc.LastFrame = frame;
+    gp.Gc.ItemsLive = 0;
+    gp.Gc.PlotsEvicted += CollectPoolGarbage(gp.Plots, gp.CurrentPlot, &gp.Gc.PlotsLive);
+    // axes re-resolve their link group index in every BeginPlot, so a stale plot never dereferences a freed group
+    CollectPoolGarbage(gp.Subplots, gp.CurrentSubplot, NULL);
+    CollectPoolGarbage(gp.LinkGroups, (const ImPlotLinkGroup*)NULL, NULL);
+}
+
+// Removes entries of the item cache #pool whose item is no longer in #plot
+template <typename T>
+static void CollectItemCacheGarbage(ImPlotState& plot, ImPool<T>& pool) {
+    int evicted = 0;
+    for (int i = 0; i < pool.Map.Data.Size; ++i) {
+        const int idx = pool.Map.Data[i].val_i;
+        if (idx == -1)
+            continue;
+        const ImGuiID key = pool.Map.Data[i].key;
+        if (plot.Items.GetByKey(key) == NULL) {
+            pool.Remove(key, idx);
+            evicted++;
+        }
+    }
+    if (evicted > 0)
+        CompactPoolMap(pool.Map);
+}
+
+void CollectItemGarbage(ImPlotState& plot) {
+    ImPlotContext& gp = *GImPlot;
+    int live    = 0;
+    int evicted = 0;
+    for (int i = 0; i < plot.Items.Map.Data.Size; ++i) {
+        const int idx = plot.Items.Map.Data[i].val_i;
+        if (idx == -1)
+            continue;
+        ImPlotItem* item = plot.Items.GetByIndex(idx);
+        if (!item->SeenThisFrame && gp.Gc.Expired(item->LastFrameSeen, item->LastTimeSeen)) {
+            // survivors keep their Color, so colormap assignment is unaffected
+            plot.Items.Remove(plot.Items.Map.Data[i].key, idx);
+            evicted++;
+        }
+        else {
+            item->SeenThisFrame = false;
+            live++;
+        }
+    }
+    if (evicted > 0) {
+        CompactPoolMap(plot.Items.Map);
+        CollectItemCacheGarbage(plot, plot.HistogramCaches);
+        CollectItemCacheGarbage(plot, plot.Histogram2DCaches);
+        CollectItemCacheGarbage(plot, plot.HitIndices);
+        CollectItemCacheGarbage(plot, plot.CandleCaches);
+    }
+    gp.Gc.ItemsLive    += live;
+    gp.Gc.ItemsEvicted += evicted;
+}
+
 void FitPoint(const ImPlotPoint& p) {
     ImPlotContext& gp = *GImPlot;
     const int y_axis  = gp.CurrentPlot->CurrentYAxis;
@@ -425,6 +634,38 @@ void PullLinkedAxis(ImPlotAxis& axis) {
     if (axis.LinkedMax) { axis.SetMax(*axis.LinkedMax); }
 }
 
+void TouchLinkGroup(ImPlotAxis& axis) {
+    if (axis.LinkGroup == -1)
+        return;
+    ImPlotLinkGroup& group = *GImPlot->LinkGroups.GetByIndex(axis.LinkGroup);
+    group.LastFrameSeen = ImGui::GetFrameCount();
+    group.LastTimeSeen  = ImGui::GetTime();
+}
+
+void PushLinkGroup(ImPlotAxis& axis) {
+    if (axis.LinkGroup == -1)
+        return;
+    ImPlotLinkGroup& group = *GImPlot->LinkGroups.GetByIndex(axis.LinkGroup);
+    if (group.Range.Min != axis.Range.Min || group.Range.Max != axis.Range.Max) {
+        group.Range = axis.Range;
+        group.Generation++;
+    }
+}
+
+void PullLinkGroup(ImPlotAxis& axis) {
+    if (axis.LinkGroup == -1)
+        return;
+    ImPlotLinkGroup& group = *GImPlot->LinkGroups.GetByIndex(axis.LinkGroup);
+    if (ImNanOrInf(group.Range.Min) || ImNanOrInf(group.Range.Max)) {
+        // the first axis to join seeds the group
+        group.Range = axis.Range;
+        group.Generation++;
+    }
+    else if (group.Range.Min != axis.Range.Min || group.Range.Max != axis.Range.Max) {
+        axis.SetRange(group.Range);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Coordinate Utils
 //-----------------------------------------------------------------------------
@@ -507,6 +748,26 @@ const char* GetLegendLabel(int i) {
     return gp.LegendLabels.Buf.Data + item->NameOffset;
 }
 
+float GetLegendLabelWidth() {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotState& plot = *gp.CurrentPlot;
+    ImGuiContext& G   = *GImGui;
+    ImGuiID key = ImHashData(gp.LegendIndices.Data, gp.LegendIndices.Size * sizeof(int));
+    key = ImHashData(gp.LegendLabels.Buf.Data, gp.LegendLabels.Buf.Size, key);
+    key = ImHashData(&G.Font, sizeof(G.Font), key);
+    key = ImHashData(&G.FontSize, sizeof(G.FontSize), key);
+    if (key != plot.LegendLayoutKey) {
+        float max_label_width = 0;
+        for (int i = 0; i < gp.LegendIndices.Size; ++i) {
+            ImVec2 label_size = CalcTextSizeCached(GetLegendLabel(i), NULL, true);
+            max_label_width   = label_size.x > max_label_width ? label_size.x : max_label_width;
+        }
+        plot.LegendLayoutKey  = key;
+        plot.LegendLabelWidth = max_label_width;
+    }
+    return plot.LegendLabelWidth;
+}
+
 //-----------------------------------------------------------------------------
 // Tick Utils
 //-----------------------------------------------------------------------------
@@ -517,7 +778,7 @@ void LabelTickDefault(ImPlotTick& tick, ImGuiTextBuffer& buffer) {
         tick.BufferOffset = buffer.size();
         snprintf(temp, 32, "%.10g", tick.PlotPos);
         buffer.append(temp, temp + strlen(temp) + 1);
-        tick.LabelSize = ImGui::CalcTextSize(buffer.Buf.Data + tick.BufferOffset);
+        tick.LabelSize = CalcTextSizeCached(buffer.Buf.Data + tick.BufferOffset);
     }
 }
 
@@ -527,7 +788,7 @@ void LabelTickScientific(ImPlotTick& tick, ImGuiTextBuffer& buffer) {
         tick.BufferOffset = buffer.size();
         snprintf(temp, 32, "%.0E", tick.PlotPos);
         buffer.append(temp, temp + strlen(temp) + 1);
-        tick.LabelSize = ImGui::CalcTextSize(buffer.Buf.Data + tick.BufferOffset);
+        tick.LabelSize = CalcTextSizeCached(buffer.Buf.Data + tick.BufferOffset);
     }
 }
 
@@ -585,7 +846,7 @@ void AddTicksCustom(const double* values, const char** labels, int n, ImPlotTick
         if (labels != NULL) {
             tick.BufferOffset = ticks.Labels.size();
             ticks.Labels.append(labels[i], labels[i] + strlen(labels[i]) + 1);
-            tick.LabelSize = ImGui::CalcTextSize(labels[i]);
+            tick.LabelSize = CalcTextSizeCached(labels[i]);
         }
         else {
             LabelTickDefault(tick, ticks.Labels);
@@ -771,6 +1032,43 @@ ImPlotTime RoundTime(const ImPlotTime& t, ImPlotTimeUnit unit) {
     return t.S - t1.S < t2.S - t.S ? t1 : t2;
 }
 
+void GetTimeStepForSpan(double min_span, ImPlotTimeUnit* unit, int* step) {
+    static const int steps_sub[] = {1,2,5,10,20,25,50,100,200,250,500};
+    static const int steps_sec[] = {1,5,10,15,30};
+    static const int steps_hr[]  = {1,2,3,6,12};
+    static const int steps_day[] = {1,2,7,14};
+    static const int steps_mo[]  = {1,2,3,6};
+    static const int steps_yr[]  = {1,2,5,10,20,50,100,200,500,1000};
+    static const int* steps[ImPlotTimeUnit_COUNT] = {steps_sub, steps_sub, steps_sec, steps_sec, steps_hr, steps_day, steps_mo, steps_yr};
+    static const int  sizes[ImPlotTimeUnit_COUNT] = {11, 11, 5, 5, 5, 4, 4, 10};
+    for (int u = 0; u < ImPlotTimeUnit_COUNT; ++u) {
+        for (int k = 0; k < sizes[u]; ++k) {
+            if (steps[u][k] * TimeUnitSpans[u] >= min_span) {
+                *unit = (ImPlotTimeUnit)u;
+                *step = steps[u][k];
+                return;
+            }
+        }
+    }
+    *unit = ImPlotTimeUnit_Yr;
+    *step = steps_yr[9];
+}
+
+ImPlotTime FloorTimeStep(const ImPlotTime& t, ImPlotTimeUnit unit, int step) {
+    if (step <= 1)
+        return FloorTime(t, unit);
+    // units up to an hour divide the epoch evenly, so buckets can be aligned arithmetically
+    if (unit <= ImPlotTimeUnit_Hr) {
+        const double span = step * TimeUnitSpans[unit];
+        return ImPlotTime::FromDouble(floor(t.ToDouble() / span) * span);
+    }
+    if (unit == ImPlotTimeUnit_Yr) {
+        const int year = GetYear(t);
+        return MakeYear(year - year % step);
+    }
+    return FloorTime(t, unit);
+}
+
 int GetYear(const ImPlotTime& t) {
     tm& Tm = GImPlot->Tm;
     GetTime(t, &Tm);
@@ -839,22 +1137,22 @@ void PrintTime(const ImPlotTime& t, ImPlotTimeFmt fmt) {
 // Returns the nominally largest possible width for a time format
 inline float GetTimeLabelWidth(ImPlotTimeFmt fmt) {
     switch (fmt) {
-        case ImPlotTimeFmt_Us:            return ImGui::CalcTextSize(".888 888").x;             // .428 552
-        case ImPlotTimeFmt_SUs:           return ImGui::CalcTextSize(":88.888 888").x;          // :29.428 552
-        case ImPlotTimeFmt_SMs:           return ImGui::CalcTextSize(":88.888").x;             // :29.428
-        case ImPlotTimeFmt_S:             return ImGui::CalcTextSize(":88").x;                 // :29
-        case ImPlotTimeFmt_HrMinS:        return ImGui::CalcTextSize("88:88:88pm").x;          // 7:21:29pm
-        case ImPlotTimeFmt_HrMin:         return ImGui::CalcTextSize("88:88pm").x;             // 7:21pm
-        case ImPlotTimeFmt_Hr:            return ImGui::CalcTextSize("88pm").x;                // 7pm
-        case ImPlotTimeFmt_DayMo:         return ImGui::CalcTextSize("88/88").x;               // 10/3
-        case ImPlotTimeFmt_DayMoHr:       return ImGui::CalcTextSize("88/88 88pm").x;          // 10/3 7:21pm
-        case ImPlotTimeFmt_DayMoHrMin:    return ImGui::CalcTextSize("88/88 88:88pm").x;       // 10/3 7:21pm
-        case ImPlotTimeFmt_DayMoYr:       return ImGui::CalcTextSize("88/88/88").x;            // 10/3/1991
-        case ImPlotTimeFmt_DayMoYrHrMin:  return ImGui::CalcTextSize("88/88/88 88:88pm").x;    // 10/3/91 7:21pm
-        case ImPlotTimeFmt_DayMoYrHrMinS: return ImGui::CalcTextSize("88/88/88 88:88:88pm").x; // 10/3/91 7:21:29pm
-        case ImPlotTimeFmt_MoYr:          return ImGui::CalcTextSize("MMM 8888").x;            // Oct 1991
-        case ImPlotTimeFmt_Mo:            return ImGui::CalcTextSize("MMM").x;                 // Oct
-        case ImPlotTimeFmt_Yr:            return ImGui::CalcTextSize("8888").x;                // 1991
+        case ImPlotTimeFmt_Us:            return CalcTextSizeCached(".888 888").x;             // .428 552
+        case ImPlotTimeFmt_SUs:           return CalcTextSizeCached(":88.888 888").x;          // :29.428 552
+        case ImPlotTimeFmt_SMs:           return CalcTextSizeCached(":88.888").x;             // :29.428
+        case ImPlotTimeFmt_S:             return CalcTextSizeCached(":88").x;                 // :29
+        case ImPlotTimeFmt_HrMinS:        return CalcTextSizeCached("88:88:88pm").x;          // 7:21:29pm
+        case ImPlotTimeFmt_HrMin:         return CalcTextSizeCached("88:88pm").x;             // 7:21pm
+        case ImPlotTimeFmt_Hr:            return CalcTextSizeCached("88pm").x;                // 7pm
+        case ImPlotTimeFmt_DayMo:         return CalcTextSizeCached("88/88").x;               // 10/3
+        case ImPlotTimeFmt_DayMoHr:       return CalcTextSizeCached("88/88 88pm").x;          // 10/3 7:21pm
+        case ImPlotTimeFmt_DayMoHrMin:    return CalcTextSizeCached("88/88 88:88pm").x;       // 10/3 7:21pm
+        case ImPlotTimeFmt_DayMoYr:       return CalcTextSizeCached("88/88/88").x;            // 10/3/1991
+        case ImPlotTimeFmt_DayMoYrHrMin:  return CalcTextSizeCached("88/88/88 88:88pm").x;    // 10/3/91 7:21pm
+        case ImPlotTimeFmt_DayMoYrHrMinS: return CalcTextSizeCached("88/88/88 88:88:88pm").x; // 10/3/91 7:21:29pm
+        case ImPlotTimeFmt_MoYr:          return CalcTextSizeCached("MMM 8888").x;            // Oct 1991
+        case ImPlotTimeFmt_Mo:            return CalcTextSizeCached("MMM").x;                 // Oct
+        case ImPlotTimeFmt_Yr:            return CalcTextSizeCached("8888").x;                // 1991
         default:                          return 0;
     }
 }
@@ -865,7 +1163,7 @@ inline void LabelTickTime(ImPlotTick& tick, ImGuiTextBuffer& buffer, const ImPlo
         tick.BufferOffset = buffer.size();
         FormatTime(t, temp, 32, fmt);
         buffer.append(temp, temp + strlen(temp) + 1);
-        tick.LabelSize = ImGui::CalcTextSize(buffer.Buf.Data + tick.BufferOffset);
+        tick.LabelSize = CalcTextSizeCached(buffer.Buf.Data + tick.BufferOffset);
     }
 }
 
@@ -1033,6 +1331,13 @@ void UpdateAxisColors(int axis_flag, ImPlotAxisColor* col) {
 // BeginPlot()
 //-----------------------------------------------------------------------------
 
+// Returns the frame of a subplot grid cell, snapped to whole pixels so neighboring cells don't overlap
+static inline ImRect CalcSubplotCellRect(const ImPlotSubplot& subplot, int row, int col) {
+    const ImVec2 cell_size(subplot.GridRect.GetWidth() / subplot.Cols, subplot.GridRect.GetHeight() / subplot.Rows);
+    const ImVec2 cell_min = subplot.GridRect.Min + ImVec2(col * cell_size.x, row * cell_size.y);
+    return ImRect(ImFloor(cell_min), ImFloor(cell_min + cell_size));
+}
+
 bool BeginPlot(const char* title, const char* x_label, const char* y_label, const ImVec2& size,
                ImPlotFlags flags, ImPlotAxisFlags x_flags, ImPlotAxisFlags y_flags, ImPlotAxisFlags y2_flags, ImPlotAxisFlags y3_flags)
 {
@@ -1041,6 +1346,7 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     IM_ASSERT_USER_ERROR(gp.CurrentPlot == NULL, "Mismatched BeginPlot()/EndPlot()!");
     IM_ASSERT_USER_ERROR(!(ImHasFlag(x_flags, ImPlotAxisFlags_Time) && ImHasFlag(x_flags, ImPlotAxisFlags_LogScale)), "ImPlotAxisFlags_Time and ImPlotAxisFlags_LogScale cannot be enabled at the same time!");
     IM_ASSERT_USER_ERROR(!ImHasFlag(y_flags, ImPlotAxisFlags_Time), "Y axes cannot display time formatted labels!");
+    IMPLOT_PROFILE_SCOPE("ImPlot::BeginPlot");
 
     // FRONT MATTER  -----------------------------------------------------------
 
@@ -1051,17 +1357,31 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
         return false;
     }
 
+    // claim the next cell of the current subplot grid, if any
+    ImPlotSubplot* subplot = gp.CurrentSubplot;
+    int subplot_row = 0, subplot_col = 0;
+    if (subplot != NULL) {
+        IM_ASSERT_USER_ERROR(subplot->CurrentIdx < subplot->Rows * subplot->Cols, "Too many calls to BeginPlot() for the current subplot grid!");
+        subplot_row = subplot->CurrentIdx / subplot->Cols;
+        subplot_col = subplot->CurrentIdx % subplot->Cols;
+        subplot->CurrentIdx++;
+    }
+
     const ImGuiID     ID       = Window->GetID(title);
     const ImGuiStyle &Style    = G.Style;
     const ImGuiIO &   IO       = ImGui::GetIO();
 
+    CollectPlotGarbage();
     bool just_created = gp.Plots.GetByKey(ID) == NULL;
     gp.CurrentPlot    = gp.Plots.GetOrAddByKey(ID);
     ImPlotState &plot = *gp.CurrentPlot;
 
-    plot.CurrentYAxis = 0;
+    plot.CurrentYAxis  = 0;
+    plot.LastFrameSeen = ImGui::GetFrameCount();
+    plot.LastTimeSeen  = ImGui::GetTime();
 
     if (just_created) {
+        ImFormatString(plot.DebugName, IM_ARRAYSIZE(plot.DebugName), "%s", title);
         plot.Flags          = flags;
         plot.XAxis.Flags    = x_flags;
         plot.YAxis[0].Flags = y_flags;
@@ -1089,8 +1409,8 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     plot.YAxis[1].PreviousFlags = y2_flags;
     plot.YAxis[2].PreviousFlags = y3_flags;
 
-    // capture scroll with a child region
-    if (!ImHasFlag(plot.Flags, ImPlotFlags_NoChild)) {
+    // capture scroll with a child region (subplot cells share the child region of their grid)
+    if (subplot == NULL && !ImHasFlag(plot.Flags, ImPlotFlags_NoChild) && !ImHasFlag(plot.Flags, ImPlotFlags_Sparkline)) {
         ImGui::BeginChild(title, ImVec2(size.x == 0 ? IMPLOT_DEFAULT_W : size.x, size.y == 0 ? IMPLOT_DEFAULT_H : size.y));
         Window = ImGui::GetCurrentWindow();
         Window->ScrollMax.y = 1.0f;
@@ -1102,8 +1422,33 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
 
     ImDrawList &DrawList = *Window->DrawList;
 
+    plot.Metrics.Clear();
+    // lightweight plots never pay for metrics capture
+    if (ImHasFlag(plot.Flags, ImPlotFlags_Sparkline))
+        gp.PlotCapture.Active = false;
+    else
+        BeginMetricsCapture(gp.PlotCapture, DrawList);
+
     // NextPlotData -----------------------------------------------------------
 
+    // subplot linked axes (explicit LinkNextPlotLimits/LinkNextPlotAxes take precedence)
+    if (subplot != NULL) {
+        if (subplot->LinksX() && gp.NextPlotData.LinkGroupX == 0 && gp.NextPlotData.LinkedXmin == NULL && gp.NextPlotData.LinkedXmax == NULL)
+            gp.NextPlotData.LinkGroupX = subplot->GetColLinkID(subplot_col);
+        if (subplot->LinksY() && gp.NextPlotData.LinkGroupY[0] == 0 && gp.NextPlotData.LinkedYmin[0] == NULL && gp.NextPlotData.LinkedYmax[0] == NULL)
+            gp.NextPlotData.LinkGroupY[0] = subplot->GetRowLinkID(subplot_row);
+    }
+
+    // link groups
+    plot.XAxis.LinkGroup = gp.NextPlotData.LinkGroupX != 0 ? gp.LinkGroups.GetIndex(gp.LinkGroups.GetOrAddByKey(gp.NextPlotData.LinkGroupX)) : -1;
+    TouchLinkGroup(plot.XAxis);
+    PullLinkGroup(plot.XAxis);
+    for (int i = 0; i < IMPLOT_Y_AXES; ++i) {
+        plot.YAxis[i].LinkGroup = gp.NextPlotData.LinkGroupY[i] != 0 ? gp.LinkGroups.GetIndex(gp.LinkGroups.GetOrAddByKey(gp.NextPlotData.LinkGroupY[i])) : -1;
+        TouchLinkGroup(plot.YAxis[i]);
+        PullLinkGroup(plot.YAxis[i]);
+    }
+
     // linked axes
     plot.XAxis.LinkedMin = gp.NextPlotData.LinkedXmin;
     plot.XAxis.LinkedMax = gp.NextPlotData.LinkedXmax;
@@ -1150,6 +1495,51 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     for (int i = 0; i < IMPLOT_Y_AXES; ++i)
         plot.YAxis[i].Constrain();
 
+    // SPARKLINE --------------------------------------------------------------
+
+    // lightweight plots only need a frame and the transforms: no axis colors, ticks, input, decorations or menus
+    if (ImHasFlag(plot.Flags, ImPlotFlags_Sparkline)) {
+        if (subplot != NULL) {
+            gp.BB_Frame = CalcSubplotCellRect(*subplot, subplot_row, subplot_col);
+        }
+        else {
+            gp.BB_Frame = ImRect(Window->DC.CursorPos, Window->DC.CursorPos + ImGui::CalcItemSize(size, IMPLOT_DEFAULT_W, IMPLOT_DEFAULT_H));
+            ImGui::ItemSize(gp.BB_Frame);
+        }
+        if (!ImGui::ItemAdd(gp.BB_Frame, 0, &gp.BB_Frame)) {
+            Reset(GImPlot);
+            return false;
+        }
+        gp.BB_Canvas = ImRect(gp.BB_Frame.Min + gp.Style.PlotPadding, gp.BB_Frame.Max - gp.Style.PlotPadding);
+        gp.BB_Plot   = gp.BB_Canvas;
+        gp.Hov_Frame = ImGui::ItemHoverable(gp.BB_Frame, ID);
+        gp.Hov_Plot  = gp.Hov_Frame && gp.BB_Plot.Contains(IO.MousePos);
+        gp.RenderX   = false;
+        plot.XAxis.HoveredExt = plot.XAxis.HoveredTot = false;
+        for (int i = 0; i < IMPLOT_Y_AXES; ++i) {
+            gp.RenderY[i] = false;
+            plot.YAxis[i].HoveredExt = plot.YAxis[i].HoveredTot = false;
+        }
+        // fit from FitNextPlotAxes
+        if (gp.NextPlotData.FitX) {
+            gp.FitThisFrame = true;
+            gp.FitX         = true;
+        }
+        for (int i = 0; i < IMPLOT_Y_AXES; ++i) {
+            if (gp.NextPlotData.FitY[i]) {
+                gp.FitThisFrame = true;
+                gp.FitY[i]      = true;
+            }
+        }
+        UpdateTransformCache();
+        for (int i = 0; i < IMPLOT_Y_AXES; i++)
+            gp.MousePos[i] = PixelsToPlot(IO.MousePos, i);
+        DrawList.AddRectFilled(gp.BB_Frame.Min, gp.BB_Frame.Max, GetStyleColorU32(ImPlotCol_FrameBg), Style.FrameRounding);
+        DrawList.AddRectFilled(gp.BB_Plot.Min, gp.BB_Plot.Max, GetStyleColorU32(ImPlotCol_PlotBg));
+        ImGui::PushID(ID);
+        return true;
+    }
+
 
     // AXIS COLORS -----------------------------------------------------------------
 
@@ -1161,13 +1551,19 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     // BB, PADDING, HOVER -----------------------------------------------------------
 
     // frame
-    ImVec2 frame_size = ImGui::CalcItemSize(size, IMPLOT_DEFAULT_W, IMPLOT_DEFAULT_H);
-    if (frame_size.x < gp.Style.PlotMinSize.x && size.x < 0.0f)
-        frame_size.x = gp.Style.PlotMinSize.x;
-    if (frame_size.y < gp.Style.PlotMinSize.y && size.y < 0.0f)
-        frame_size.y = gp.Style.PlotMinSize.y;
-    gp.BB_Frame = ImRect(Window->DC.CursorPos, Window->DC.CursorPos + frame_size);
-    ImGui::ItemSize(gp.BB_Frame);
+    if (subplot != NULL) {
+        // the grid was already laid out (and sized) by BeginSubplots
+        gp.BB_Frame = CalcSubplotCellRect(*subplot, subplot_row, subplot_col);
+    }
+    else {
+        ImVec2 frame_size = ImGui::CalcItemSize(size, IMPLOT_DEFAULT_W, IMPLOT_DEFAULT_H);
+        if (frame_size.x < gp.Style.PlotMinSize.x && size.x < 0.0f)
+            frame_size.x = gp.Style.PlotMinSize.x;
+        if (frame_size.y < gp.Style.PlotMinSize.y && size.y < 0.0f)
+            frame_size.y = gp.Style.PlotMinSize.y;
+        gp.BB_Frame = ImRect(Window->DC.CursorPos, Window->DC.CursorPos + frame_size);
+        ImGui::ItemSize(gp.BB_Frame);
+    }
     if (!ImGui::ItemAdd(gp.BB_Frame, 0, &gp.BB_Frame)) {
         Reset(GImPlot);
         return false;
@@ -1191,43 +1587,92 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     // plot bb
 
     // (1) calc top/bot padding and plot height
-    const ImVec2 title_size = ImGui::CalcTextSize(title, NULL, true);
+    const ImVec2 title_size = CalcTextSizeCached(title, NULL, true);
     const float txt_height  = ImGui::GetTextLineHeight();
 
-    const float pad_top = title_size.x > 0.0f ? txt_height + gp.Style.LabelPadding.y : 0;
-    const float pad_bot = (gp.X.HasLabels ? txt_height + gp.Style.LabelPadding.y + (gp.X.IsTime ? txt_height + gp.Style.LabelPadding.y : 0) : 0)
+    const bool subplot_align = subplot != NULL && !ImHasFlag(subplot->Flags, ImPlotSubplotFlags_NoAlign);
+
+    float pad_top = title_size.x > 0.0f ? txt_height + gp.Style.LabelPadding.y : 0;
+    float pad_bot = (gp.X.HasLabels ? txt_height + gp.Style.LabelPadding.y + (gp.X.IsTime ? txt_height + gp.Style.LabelPadding.y : 0) : 0)
                         + (x_label ? txt_height + gp.Style.LabelPadding.y : 0);
 
+    // align the plot areas of each subplot row (gutters settle one frame after they grow)
+    if (subplot_align) {
+        float* next = &subplot->NextRowPads[2 * subplot_row];
+        next[0]  = ImMax(next[0], pad_top);
+        next[1]  = ImMax(next[1], pad_bot);
+        pad_top  = ImMax(pad_top, subplot->RowPads[2 * subplot_row]);
+        pad_bot  = ImMax(pad_bot, subplot->RowPads[2 * subplot_row + 1]);
+    }
+
     const float plot_height = gp.BB_Canvas.GetHeight() - pad_top - pad_bot;
 
     // (2) get y tick labels (needed for left/right pad)
+    IMPLOT_PROFILE_BEGIN("ImPlot::BeginPlot/Ticks");
     for (int i = 0; i < IMPLOT_Y_AXES; i++) {
         if (gp.RenderY[i] && gp.NextPlotData.ShowDefaultTicksY[i]) {
-            if (ImHasFlag(plot.YAxis[i].Flags, ImPlotAxisFlags_LogScale))
-                AddTicksLogarithmic(plot.YAxis[i].Range, ImMax(2, (int)IM_ROUND(plot_height * 0.02f)) ,gp.YTicks[i]);
-            else
-                AddTicksDefault(plot.YAxis[i].Range, ImMax(2, (int)IM_ROUND(0.0025 * plot_height)), IMPLOT_SUB_DIV, gp.YTicks[i]);
+            // reuse last frame's ticks if nothing they depend on changed (custom ticks bypass the cache);
+            // cells in a linked subplot row share one cache so their ticks are only generated once
+            ImPlotTickCache& cache = (i == 0 && subplot != NULL && subplot->LinksY()) ? subplot->RowTickCache[subplot_row] : plot.YTickCache[i];
+            const bool cacheable = gp.YTicks[i].Size == 0;
+            if (cacheable && cache.Matches(plot.YAxis[i].Range, plot_height, plot.YAxis[i].Flags, false)) {
+                gp.YTicks[i] = cache.Ticks;
+            }
+            else {
+                if (ImHasFlag(plot.YAxis[i].Flags, ImPlotAxisFlags_LogScale))
+                    AddTicksLogarithmic(plot.YAxis[i].Range, ImMax(2, (int)IM_ROUND(plot_height * 0.02f)) ,gp.YTicks[i]);
+                else
+                    AddTicksDefault(plot.YAxis[i].Range, ImMax(2, (int)IM_ROUND(0.0025 * plot_height)), IMPLOT_SUB_DIV, gp.YTicks[i]);
+                if (cacheable)
+                    cache.Store(gp.YTicks[i], plot.YAxis[i].Range, plot_height, plot.YAxis[i].Flags, false);
+                else
+                    cache.Invalidate();
+            }
         }
     }
+    IMPLOT_PROFILE_END("ImPlot::BeginPlot/Ticks");
 
     // (3) calc left/right pad
-    const float pad_left    = (y_label ? txt_height + gp.Style.LabelPadding.x : 0)
+    float pad_left          = (y_label ? txt_height + gp.Style.LabelPadding.x : 0)
                             + (gp.Y[0].HasLabels ? gp.YTicks[0].MaxWidth + gp.Style.LabelPadding.x : 0);
-    const float pad_right   = ((gp.Y[1].Present && gp.Y[1].HasLabels) ? gp.YTicks[1].MaxWidth + gp.Style.LabelPadding.x : 0)
+    float pad_right         = ((gp.Y[1].Present && gp.Y[1].HasLabels) ? gp.YTicks[1].MaxWidth + gp.Style.LabelPadding.x : 0)
                             + ((gp.Y[1].Present && gp.Y[2].Present)   ? gp.Style.LabelPadding.x + gp.Style.MinorTickLen.y : 0)
                             + ((gp.Y[2].Present && gp.Y[2].HasLabels) ? gp.YTicks[2].MaxWidth + gp.Style.LabelPadding.x : 0);
 
+    // align the plot areas of each subplot column
+    if (subplot_align) {
+        float* next = &subplot->NextColPads[2 * subplot_col];
+        next[0]   = ImMax(next[0], pad_left);
+        next[1]   = ImMax(next[1], pad_right);
+        pad_left  = ImMax(pad_left, subplot->ColPads[2 * subplot_col]);
+        pad_right = ImMax(pad_right, subplot->ColPads[2 * subplot_col + 1]);
+    }
+
     const float plot_width = gp.BB_Canvas.GetWidth() - pad_left - pad_right;
 
     // (4) get x ticks
+    IMPLOT_PROFILE_BEGIN("ImPlot::BeginPlot/Ticks");
     if (gp.RenderX && gp.NextPlotData.ShowDefaultTicksX) {
-        if (gp.X.IsTime)
-            AddTicksTime(plot.XAxis.Range, plot_width, gp.XTicks);
-        else if (ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LogScale))
-            AddTicksLogarithmic(plot.XAxis.Range, (int)IM_ROUND(plot_width * 0.01f), gp.XTicks);
-        else
-            AddTicksDefault(plot.XAxis.Range, ImMax(2, (int)IM_ROUND(0.0025 * plot_width)), IMPLOT_SUB_DIV, gp.XTicks);
+        ImPlotTickCache& cache = (subplot != NULL && subplot->LinksX()) ? subplot->ColTickCache[subplot_col] : plot.XTickCache;
+        const bool cacheable  = gp.XTicks.Size == 0;
+        const bool local_time = gp.X.IsTime && gp.Style.UseLocalTime;
+        if (cacheable && cache.Matches(plot.XAxis.Range, plot_width, plot.XAxis.Flags, local_time)) {
+            gp.XTicks = cache.Ticks;
+        }
+        else {
+            if (gp.X.IsTime)
+                AddTicksTime(plot.XAxis.Range, plot_width, gp.XTicks);
+            else if (ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LogScale))
+                AddTicksLogarithmic(plot.XAxis.Range, (int)IM_ROUND(plot_width * 0.01f), gp.XTicks);
+            else
+                AddTicksDefault(plot.XAxis.Range, ImMax(2, (int)IM_ROUND(0.0025 * plot_width)), IMPLOT_SUB_DIV, gp.XTicks);
+            if (cacheable)
+                cache.Store(gp.XTicks, plot.XAxis.Range, plot_width, plot.XAxis.Flags, local_time);
+            else
+                cache.Invalidate();
+        }
     }
+    IMPLOT_PROFILE_END("ImPlot::BeginPlot/Ticks");
 
     // (5) calc plot bb
     gp.BB_Plot  = ImRect(gp.BB_Canvas.Min + ImVec2(pad_left, pad_top), gp.BB_Canvas.Max - ImVec2(pad_right, pad_bot));
@@ -1283,6 +1728,7 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     }
 
     // QUERY DRAG -------------------------------------------------------------
+    IMPLOT_PROFILE_BEGIN("ImPlot::BeginPlot/Input");
     if (plot.DraggingQuery && (IO.MouseReleased[gp.InputMap.PanButton] || !IO.MouseDown[gp.InputMap.PanButton])) {
         plot.DraggingQuery = false;
     }
@@ -1372,7 +1818,11 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
 
     // SCROLL INPUT -----------------------------------------------------------
 
-    if (gp.Hov_Frame && (plot.XAxis.HoveredTot || any_hov_y_axis_region) && IO.MouseWheel != 0) {
+    if (hov_legend && ImHasFlag(plot.Flags, ImPlotFlags_ScrollLegend) && IO.MouseWheel != 0) {
+        // scrolling a virtualized legend takes priority over zooming (clamped in EndPlot)
+        plot.LegendScroll += IO.MouseWheel > 0 ? -3 : 3;
+    }
+    else if (gp.Hov_Frame && (plot.XAxis.HoveredTot || any_hov_y_axis_region) && IO.MouseWheel != 0) {
         UpdateTransformCache();
         float zoom_rate = IMPLOT_ZOOM_RATE;
         if (IO.MouseWheel > 0)
@@ -1508,6 +1958,13 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
         }
     }
 
+    // LINK GROUPS ------------------------------------------------------------
+
+    // publish input changes right away, so plots begun later this frame don't lag behind
+    PushLinkGroup(plot.XAxis);
+    for (int i = 0; i < IMPLOT_Y_AXES; ++i)
+        PushLinkGroup(plot.YAxis[i]);
+
     // FOCUS ------------------------------------------------------------------
 
     // focus window
@@ -1520,8 +1977,10 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     for (int i = 0; i < IMPLOT_Y_AXES; i++) {
         gp.MousePos[i] = PixelsToPlot(IO.MousePos, i);
     }
+    IMPLOT_PROFILE_END("ImPlot::BeginPlot/Input");
 
     // RENDER -----------------------------------------------------------------
+    IMPLOT_PROFILE_BEGIN("ImPlot::BeginPlot/Render");
 
     // grid bg
     DrawList.AddRectFilled(gp.BB_Plot.Min, gp.BB_Plot.Max, GetStyleColorU32(ImPlotCol_PlotBg));
@@ -1589,7 +2048,7 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
 
     // render axis labels
     if (x_label) {
-        const ImVec2 xLabel_size = ImGui::CalcTextSize(x_label);
+        const ImVec2 xLabel_size = CalcTextSizeCached(x_label);
         const ImVec2 xLabel_pos(gp.BB_Plot.GetCenter().x - xLabel_size.x * 0.5f, gp.BB_Canvas.Max.y - txt_height);
         DrawList.AddText(xLabel_pos, gp.Col_X.MajTxt, x_label);
     }
@@ -1622,6 +2081,7 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
         }
     }
     ImGui::PopClipRect();
+    IMPLOT_PROFILE_END("ImPlot::BeginPlot/Render");
 
     // push plot ID into stack
     ImGui::PushID(ID);
@@ -1772,12 +2232,20 @@ void ShowPlotContextMenu(ImPlotState& plot) {
     if (ImGui::MenuItem("Legend",NULL,!ImHasFlag(plot.Flags, ImPlotFlags_NoLegend))) {
         ImFlipFlag(plot.Flags, ImPlotFlags_NoLegend);
     }
+    if (ImGui::MenuItem("Scroll Legend",NULL,ImHasFlag(plot.Flags, ImPlotFlags_ScrollLegend))) {
+        ImFlipFlag(plot.Flags, ImPlotFlags_ScrollLegend);
+    }
 #ifdef IMPLOT_DEBUG
     if (ImGui::BeginMenu("Debug")) {
         ImGui::PushItemWidth(50);
-        ImGui::LabelText("Plots", "%d", gp.Plots.GetSize());
+        ImGui::LabelText("Plots", "%d", gp.Gc.PlotsLive);
+        ImGui::LabelText("Evicted Plots", "%d", gp.Gc.PlotsEvicted);
+        ImGui::LabelText("Evicted Items", "%d", gp.Gc.ItemsEvicted);
+        ImGui::LabelText("Arena Peak", "%d B", gp.FrameArena.HighWater);
+        ImGui::LabelText("Arena Blocks", "%d", gp.FrameArena.HeapAllocs);
         ImGui::LabelText("Color Mods", "%d", gp.ColorModifiers.size());
         ImGui::LabelText("Style Mods", "%d", gp.StyleModifiers.size());
+        ImGui::LabelText("Text Cache", "%d (%.1f%% hits)", gp.TextSizeCache.Entries.Size, 100 * gp.TextSizeCache.HitRate());
         ImGui::TextUnformatted(gp.XTicks.Labels.Buf.Data, gp.XTicks.Labels.Buf.Data + gp.XTicks.Labels.size());
         ImGui::TextUnformatted(gp.YTicks[0].Labels.Buf.Data, gp.YTicks[0].Labels.Buf.Data + gp.YTicks[0].Labels.size());
         // ImGui::TextUnformatted(gp.YTicks[1].Labels.Buf.Data, gp.YTicks[1].Labels.Buf.Data + gp.YTicks[1].Labels.size());
@@ -1794,16 +2262,87 @@ void ShowPlotContextMenu(ImPlotState& plot) {
 // EndPlot()
 //-----------------------------------------------------------------------------
 
+// Applies the data extents gathered by the PlotX functions to the axes being fit this frame
+static void FitPlotAxes(ImPlotState& plot) {
+    ImPlotContext& gp = *GImPlot;
+    if (!gp.FitThisFrame || (gp.VisibleItemCount == 0 && !plot.Queried))
+        return;
+    if (gp.FitX && !ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LockMin) && !ImNanOrInf(gp.ExtentsX.Min)) {
+        plot.XAxis.Range.Min = (gp.ExtentsX.Min);
+    }
+    if (gp.FitX && !ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LockMax) && !ImNanOrInf(gp.ExtentsX.Max)) {
+        plot.XAxis.Range.Max = (gp.ExtentsX.Max);
+    }
+    if ((plot.XAxis.Range.Max - plot.XAxis.Range.Min) <= (2.0 * FLT_EPSILON))  {
+        plot.XAxis.Range.Max += FLT_EPSILON;
+        plot.XAxis.Range.Min -= FLT_EPSILON;
+    }
+    plot.XAxis.Constrain();
+    for (int i = 0; i < IMPLOT_Y_AXES; i++) {
+        if (gp.FitY[i] && !ImHasFlag(plot.YAxis[i].Flags, ImPlotAxisFlags_LockMin) && !ImNanOrInf(gp.ExtentsY[i].Min)) {
+            plot.YAxis[i].Range.Min = (gp.ExtentsY[i].Min);
+        }
+        if (gp.FitY[i] && !ImHasFlag(plot.YAxis[i].Flags, ImPlotAxisFlags_LockMax) && !ImNanOrInf(gp.ExtentsY[i].Max)) {
+            plot.YAxis[i].Range.Max = (gp.ExtentsY[i].Max);
+        }
+        if ((plot.YAxis[i].Range.Max - plot.YAxis[i].Range.Min) <= (2.0 * FLT_EPSILON))  {
+            plot.YAxis[i].Range.Max += FLT_EPSILON;
+            plot.YAxis[i].Range.Min -= FLT_EPSILON;
+        }
+        plot.YAxis[i].Constrain();
+    }
+}
+
+// Pushes linked axes, collects stale items, records metrics and resets the context (the last stage of EndPlot)
+static void FinishPlot(ImPlotState& plot, ImDrawList& DrawList) {
+    ImPlotContext& gp = *GImPlot;
+
+    // LINKED AXES ------------------------------------------------------------
+
+    PushLinkedAxis(plot.XAxis);
+    PushLinkGroup(plot.XAxis);
+    for (int i = 0; i < IMPLOT_Y_AXES; ++i) {
+        PushLinkedAxis(plot.YAxis[i]);
+        PushLinkGroup(plot.YAxis[i]);
+    }
+
+    // CLEANUP ----------------------------------------------------------------
+
+    // reset the plot items for the next frame and free stale ones
+    CollectItemGarbage(plot);
+
+    // record metrics history
+    if (gp.PlotCapture.Active) {
+        EndMetricsCapture(gp.PlotCapture, DrawList, plot.Metrics);
+        plot.TimeHistory[plot.HistoryOffset] = plot.Metrics.TimeMs;
+        plot.VtxHistory[plot.HistoryOffset]  = (float)plot.Metrics.Vertices;
+        plot.HistoryOffset = (plot.HistoryOffset + 1) % IMPLOT_METRICS_HISTORY;
+    }
+
+    // Pop ImGui::PushID at the end of BeginPlot
+    ImGui::PopID();
+    // Reset context for next plot
+    Reset(GImPlot);
+}
+
 void EndPlot() {
     IM_ASSERT_USER_ERROR(GImPlot != NULL, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     ImPlotContext& gp     = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "Mismatched BeginPlot()/EndPlot()!");
+    IMPLOT_PROFILE_SCOPE("ImPlot::EndPlot");
     ImGuiContext &G       = *GImGui;
     ImPlotState &plot     = *gp.CurrentPlot;
     ImGuiWindow * Window  = G.CurrentWindow;
     ImDrawList & DrawList = *Window->DrawList;
     const ImGuiIO &   IO  = ImGui::GetIO();
 
+    // lightweight plots have no overlay, legend or menus to finish
+    if (ImHasFlag(plot.Flags, ImPlotFlags_Sparkline)) {
+        FitPlotAxes(plot);
+        FinishPlot(plot, DrawList);
+        return;
+    }
+
     // AXIS STATES ------------------------------------------------------------
 
     const bool any_y_locked   = gp.Y[0].Lock || gp.Y[1].Present ? gp.Y[1].Lock : false || gp.Y[2].Present ? gp.Y[2].Lock : false;
@@ -1811,6 +2350,7 @@ void EndPlot() {
 
 
     // FINAL RENDER -----------------------------------------------------------
+    IMPLOT_PROFILE_BEGIN("ImPlot::EndPlot/Overlay");
 
     // render ticks
     PushPlotClipRect();
@@ -1917,8 +2457,10 @@ void EndPlot() {
             DrawList.AddRect(      bb_query.Min, bb_query.Max, col_bg);
         }
     }
+    IMPLOT_PROFILE_END("ImPlot::EndPlot/Overlay");
 
     // render legend
+    IMPLOT_PROFILE_BEGIN("ImPlot::EndPlot/Legend");
     const float txt_ht = ImGui::GetTextLineHeight();
     const ImVec2 legend_offset = gp.Style.LegendPadding;
     const ImVec2 legend_spacing(5, 5);
@@ -1927,14 +2469,34 @@ void EndPlot() {
     int nItems = GetLegendCount();
     bool hov_legend = false;
     if (!ImHasFlag(plot.Flags, ImPlotFlags_NoLegend) && nItems > 0) {
+        // determine the range of visible entries (all of them unless virtualized)
+        const bool scroll_legend = ImHasFlag(plot.Flags, ImPlotFlags_ScrollLegend);
+        int first_item = 0;
+        int nVisible   = nItems;
+        if (scroll_legend) {
+            const int max_rows = ImMax(1, (int)((gp.BB_Plot.GetHeight() - legend_offset.y * 2 - legend_spacing.y * 2) / txt_ht));
+            nVisible           = ImMin(nItems, max_rows);
+            plot.LegendScroll  = ImClamp(plot.LegendScroll, 0, nItems - nVisible);
+            first_item         = plot.LegendScroll;
+            for (int i = 0; i < nItems; ++i)
+                GetItem(i)->LegendHovered = false;
+        }
+        else {
+            plot.LegendScroll = 0;
+        }
+        const int last_item = first_item + nVisible;
         // get max width
         float max_label_width = 0;
-        for (int i = 0; i < nItems; ++i) {
-            const char* label = GetLegendLabel(i);
-            ImVec2 labelWidth = ImGui::CalcTextSize(label, NULL, true);
-            max_label_width   = labelWidth.x > max_label_width ? labelWidth.x : max_label_width;
+        if (scroll_legend) {
+            for (int i = first_item; i < last_item; ++i) {
+                ImVec2 labelWidth = CalcTextSizeCached(GetLegendLabel(i), NULL, true);
+                max_label_width   = labelWidth.x > max_label_width ? labelWidth.x : max_label_width;
+            }
+        }
+        else {
+            max_label_width = GetLegendLabelWidth();
         }
-        legend_content_bb = ImRect(gp.BB_Plot.Min + legend_offset, gp.BB_Plot.Min + legend_offset + ImVec2(max_label_width, nItems * txt_ht));
+        legend_content_bb = ImRect(gp.BB_Plot.Min + legend_offset, gp.BB_Plot.Min + legend_offset + ImVec2(max_label_width, nVisible * txt_ht));
         plot.BB_Legend    = ImRect(legend_content_bb.Min, legend_content_bb.Max + legend_spacing * 2 + ImVec2(legend_icon_size, 0));
         hov_legend = !ImHasFlag(plot.Flags, ImPlotFlags_NoLegend) ? gp.Hov_Frame && plot.BB_Legend.Contains(IO.MousePos) : false;
         // render legend box
@@ -1944,15 +2506,23 @@ void EndPlot() {
         ImU32  col_txt_dis = ImGui::GetColorU32(col_txt * ImVec4(1,1,1,0.25f));
         DrawList.AddRectFilled(plot.BB_Legend.Min, plot.BB_Legend.Max, col_bg);
         DrawList.AddRect(plot.BB_Legend.Min, plot.BB_Legend.Max, col_bd);
+        // render scroll indicator
+        if (nVisible < nItems) {
+            const float track_h = plot.BB_Legend.GetHeight() - 4;
+            const float thumb_y = plot.BB_Legend.Min.y + 2 + track_h * first_item / nItems;
+            const float thumb_h = ImMax(4.0f, track_h * nVisible / nItems);
+            DrawList.AddRectFilled(ImVec2(plot.BB_Legend.Max.x - 4, thumb_y), ImVec2(plot.BB_Legend.Max.x - 2, thumb_y + thumb_h), col_bd);
+        }
         // render each legend item
-        for (int i = 0; i < nItems; ++i) {
+        for (int i = first_item; i < last_item; ++i) {
             ImPlotItem* item = GetItem(i);
+            const float row_y = (i - first_item) * txt_ht;
             ImRect icon_bb;
-            icon_bb.Min = legend_content_bb.Min + legend_spacing + ImVec2(0, i * txt_ht) + ImVec2(2, 2);
-            icon_bb.Max = legend_content_bb.Min + legend_spacing + ImVec2(0, i * txt_ht) + ImVec2(legend_icon_size - 2, legend_icon_size - 2);
+            icon_bb.Min = legend_content_bb.Min + legend_spacing + ImVec2(0, row_y) + ImVec2(2, 2);
+            icon_bb.Max = legend_content_bb.Min + legend_spacing + ImVec2(0, row_y) + ImVec2(legend_icon_size - 2, legend_icon_size - 2);
             ImRect label_bb;
-            label_bb.Min = legend_content_bb.Min + legend_spacing + ImVec2(0, i * txt_ht) + ImVec2(2, 2);
-            label_bb.Max = legend_content_bb.Min + legend_spacing + ImVec2(0, i * txt_ht) + ImVec2(legend_content_bb.Max.x, legend_icon_size - 2);
+            label_bb.Min = legend_content_bb.Min + legend_spacing + ImVec2(0, row_y) + ImVec2(2, 2);
+            label_bb.Max = legend_content_bb.Min + legend_spacing + ImVec2(0, row_y) + ImVec2(legend_content_bb.Max.x, legend_icon_size - 2);
             ImU32 col_hl_txt;
             if (hov_legend && (icon_bb.Contains(IO.MousePos) || label_bb.Contains(IO.MousePos))) {
                 item->LegendHovered = true;
@@ -1980,11 +2550,13 @@ void EndPlot() {
             const char* label = GetLegendLabel(i);
             const char* text_display_end = ImGui::FindRenderedTextEnd(label, NULL);
             if (label != text_display_end)
-                DrawList.AddText(legend_content_bb.Min + legend_spacing + ImVec2(legend_icon_size, i * txt_ht), item->Show ? col_hl_txt  : col_txt_dis, label, text_display_end);
+                DrawList.AddText(legend_content_bb.Min + legend_spacing + ImVec2(legend_icon_size, row_y), item->Show ? col_hl_txt  : col_txt_dis, label, text_display_end);
         }
     }
+    IMPLOT_PROFILE_END("ImPlot::EndPlot/Legend");
 
     // render crosshairs
+    IMPLOT_PROFILE_BEGIN("ImPlot::EndPlot/Overlay");
     if (ImHasFlag(plot.Flags, ImPlotFlags_Crosshairs) && gp.Hov_Plot && gp.Hov_Frame &&
         !(plot.XAxis.Dragging || any_y_dragging) && !plot.Selecting && !plot.Querying && !hov_legend) {
         ImGui::SetMouseCursor(ImGuiMouseCursor_None);
@@ -2051,7 +2623,7 @@ void EndPlot() {
                 writer.Write(",(%.*f)", Precision(range_y), gp.MousePos[2].y);
             }
         }
-        ImVec2 size = ImGui::CalcTextSize(buffer);
+        ImVec2 size = CalcTextSizeCached(buffer);
         ImVec2 pos  = gp.BB_Plot.Max - size - gp.Style.InfoPadding;
         DrawList.AddText(pos, GetStyleColorU32(ImPlotCol_InlayText), buffer);
     }
@@ -2061,35 +2633,11 @@ void EndPlot() {
     // render border
     if (gp.Style.PlotBorderSize > 0)
         DrawList.AddRect(gp.BB_Plot.Min, gp.BB_Plot.Max, GetStyleColorU32(ImPlotCol_PlotBorder), 0, ImDrawCornerFlags_All, gp.Style.PlotBorderSize);
+    IMPLOT_PROFILE_END("ImPlot::EndPlot/Overlay");
 
     // FIT DATA --------------------------------------------------------------
 
-    if (gp.FitThisFrame && (gp.VisibleItemCount > 0 || plot.Queried)) {
-        if (gp.FitX && !ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LockMin) && !ImNanOrInf(gp.ExtentsX.Min)) {
-            plot.XAxis.Range.Min = (gp.ExtentsX.Min);
-        }
-        if (gp.FitX && !ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LockMax) && !ImNanOrInf(gp.ExtentsX.Max)) {
-            plot.XAxis.Range.Max = (gp.ExtentsX.Max);
-        }
-        if ((plot.XAxis.Range.Max - plot.XAxis.Range.Min) <= (2.0 * FLT_EPSILON))  {
-            plot.XAxis.Range.Max += FLT_EPSILON;
-            plot.XAxis.Range.Min -= FLT_EPSILON;
-        }
-        plot.XAxis.Constrain();
-        for (int i = 0; i < IMPLOT_Y_AXES; i++) {
-            if (gp.FitY[i] && !ImHasFlag(plot.YAxis[i].Flags, ImPlotAxisFlags_LockMin) && !ImNanOrInf(gp.ExtentsY[i].Min)) {
-                plot.YAxis[i].Range.Min = (gp.ExtentsY[i].Min);
-            }
-            if (gp.FitY[i] && !ImHasFlag(plot.YAxis[i].Flags, ImPlotAxisFlags_LockMax) && !ImNanOrInf(gp.ExtentsY[i].Max)) {
-                plot.YAxis[i].Range.Max = (gp.ExtentsY[i].Max);
-            }
-            if ((plot.YAxis[i].Range.Max - plot.YAxis[i].Range.Min) <= (2.0 * FLT_EPSILON))  {
-                plot.YAxis[i].Range.Max += FLT_EPSILON;
-                plot.YAxis[i].Range.Min -= FLT_EPSILON;
-            }
-            plot.YAxis[i].Constrain();
-        }
-    }
+    FitPlotAxes(plot);
 
     // CONTEXT MENUS -----------------------------------------------------------
 
@@ -2125,24 +2673,87 @@ void EndPlot() {
         ImGui::PopID();
     }
 
+    // LINKED AXES AND CLEANUP ------------------------------------------------
 
-    // LINKED AXES ------------------------------------------------------------
+    FinishPlot(plot, DrawList);
+}
 
-    PushLinkedAxis(plot.XAxis);
-    for (int i = 0; i < IMPLOT_Y_AXES; ++i)
-        PushLinkedAxis(plot.YAxis[i]);
+//-----------------------------------------------------------------------------
+// BeginSubplots() / EndSubplots()
+//-----------------------------------------------------------------------------
 
-    // CLEANUP ----------------------------------------------------------------
+bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, ImPlotSubplotFlags flags) {
+    IM_ASSERT_USER_ERROR(GImPlot != NULL, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentSubplot == NULL, "Mismatched BeginSubplots()/EndSubplots()!");
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot == NULL, "BeginSubplots() cannot be called between BeginPlot()/EndPlot()!");
+    IM_ASSERT_USER_ERROR(rows > 0 && cols > 0, "Invalid sizes for subplot grid!");
+    IMPLOT_PROFILE_SCOPE("ImPlot::BeginSubplots");
+
+    ImGuiContext &G      = *GImGui;
+    ImGuiWindow * Window = G.CurrentWindow;
+    if (Window->SkipItems)
+        return false;
 
-    // reset the plot items for the next frame
-    for (int i = 0; i < gp.CurrentPlot->Items.GetSize(); ++i) {
-        gp.CurrentPlot->Items.GetByIndex(i)->SeenThisFrame = false;
+    const ImGuiID ID = Window->GetID(title);
+    ImPlotSubplot& subplot = *gp.Subplots.GetOrAddByKey(ID);
+    subplot.ID            = ID;
+    subplot.CurrentIdx    = 0;
+    subplot.LastFrameSeen = ImGui::GetFrameCount();
+    subplot.LastTimeSeen  = ImGui::GetTime();
+
+    // (re)allocate per row/column state when the grid shape or linking changes
+    if (subplot.Rows != rows || subplot.Cols != cols || subplot.Flags != flags) {
+        subplot.Rows  = rows;
+        subplot.Cols  = cols;
+        subplot.Flags = flags;
+        subplot.ResizeTickCaches(rows, cols);
+        subplot.RowPads.resize(2 * rows);
+        subplot.ColPads.resize(2 * cols);
+        memset(subplot.RowPads.Data, 0, subplot.RowPads.size_in_bytes());
+        memset(subplot.ColPads.Data, 0, subplot.ColPads.size_in_bytes());
+        subplot.NextRowPads.resize(2 * rows);
+        subplot.NextColPads.resize(2 * cols);
+    }
+    memset(subplot.NextRowPads.Data, 0, subplot.NextRowPads.size_in_bytes());
+    memset(subplot.NextColPads.Data, 0, subplot.NextColPads.size_in_bytes());
+
+    // capture scroll with a single child region shared by every cell
+    ImGui::BeginChild(title, ImVec2(size.x == 0 ? IMPLOT_DEFAULT_W : size.x, size.y == 0 ? IMPLOT_DEFAULT_H : size.y));
+    Window = ImGui::GetCurrentWindow();
+    Window->ScrollMax.y = 1.0f;
+    subplot.ChildWindowMade = true;
+
+    // lay out the whole grid in one pass
+    subplot.FrameRect = ImRect(Window->DC.CursorPos, Window->DC.CursorPos + ImGui::GetContentRegionAvail());
+    ImGui::ItemSize(subplot.FrameRect);
+    subplot.GridRect = subplot.FrameRect;
+
+    const ImVec2 title_size = CalcTextSizeCached(title, NULL, true);
+    if (!ImHasFlag(flags, ImPlotSubplotFlags_NoTitle) && title_size.x > 0.0f) {
+        subplot.GridRect.Min.y += ImGui::GetTextLineHeight() + gp.Style.LabelPadding.y;
+        const char* title_end = ImGui::FindRenderedTextEnd(title, NULL);
+        Window->DrawList->AddText(ImVec2(subplot.FrameRect.GetCenter().x - title_size.x * 0.5f, subplot.FrameRect.Min.y), GetStyleColorU32(ImPlotCol_TitleText), title, title_end);
     }
 
-    // Pop ImGui::PushID at the end of BeginPlot
-    ImGui::PopID();
-    // Reset context for next plot
-    Reset(GImPlot);
+    gp.CurrentSubplot = &subplot;
+    return true;
+}
+
+void EndSubplots() {
+    IM_ASSERT_USER_ERROR(GImPlot != NULL, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentSubplot != NULL, "Mismatched BeginSubplots()/EndSubplots()!");
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot == NULL, "Mismatched BeginPlot()/EndPlot()!");
+    IMPLOT_PROFILE_SCOPE("ImPlot::EndSubplots");
+    ImPlotSubplot& subplot = *gp.CurrentSubplot;
+    // gutters measured this frame align the cells next frame
+    subplot.RowPads = subplot.NextRowPads;
+    subplot.ColPads = subplot.NextColPads;
+    if (subplot.ChildWindowMade)
+        ImGui::EndChild();
+    subplot.ChildWindowMade = false;
+    gp.CurrentSubplot = NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -2192,6 +2803,20 @@ void LinkNextPlotLimits(double* xmin, double* xmax, double* ymin, double* ymax,
     gp.NextPlotData.LinkedYmax[2] = ymax3;
 }
 
+void LinkNextPlotAxes(const char* x_group, const char* y_group, const char* y2_group, const char* y3_group) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot == NULL, "LinkNextPlotAxes() needs to be called before BeginPlot()!");
+    gp.NextPlotData.LinkGroupX    = x_group  != NULL ? ImHashStr(x_group)  : 0;
+    gp.NextPlotData.LinkGroupY[0] = y_group  != NULL ? ImHashStr(y_group)  : 0;
+    gp.NextPlotData.LinkGroupY[1] = y2_group != NULL ? ImHashStr(y2_group) : 0;
+    gp.NextPlotData.LinkGroupY[2] = y3_group != NULL ? ImHashStr(y3_group) : 0;
+}
+
+int GetLinkGroupGeneration(const char* group) {
+    ImPlotLinkGroup* link = GImPlot->LinkGroups.GetByKey(ImHashStr(group));
+    return link != NULL ? link->Generation : 0;
+}
+
 void FitNextPlotAxes(bool x, bool y, bool y2, bool y3) {
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot == NULL, "FitNextPlotAxes() needs to be called before BeginPlot()!");
@@ -2210,9 +2835,11 @@ void SetNextPlotTicksX(const double* values, int n_ticks, const char** labels, b
 
 void SetNextPlotTicksX(double x_min, double x_max, int n_ticks, const char** labels, bool show_default) {
     IM_ASSERT_USER_ERROR(n_ticks > 1, "The number of ticks must be greater than 1");
-    static ImVector<double> buffer;
-    FillRange(buffer, n_ticks, x_min, x_max);
-    SetNextPlotTicksX(&buffer[0], n_ticks, labels, show_default);
+    double* buffer = AllocFrame<double>(n_ticks);
+    const double step = (x_max - x_min) / (n_ticks - 1);
+    for (int i = 0; i < n_ticks; ++i)
+        buffer[i] = x_min + i * step;
+    SetNextPlotTicksX(buffer, n_ticks, labels, show_default);
 }
 
 void SetNextPlotTicksY(const double* values, int n_ticks, const char** labels, bool show_default, int y_axis) {
@@ -2225,9 +2852,11 @@ void SetNextPlotTicksY(const double* values, int n_ticks, const char** labels, b
 
 void SetNextPlotTicksY(double y_min, double y_max, int n_ticks, const char** labels, bool show_default, int y_axis) {
     IM_ASSERT_USER_ERROR(n_ticks > 1, "The number of ticks must be greater than 1");
-    static ImVector<double> buffer;
-    FillRange(buffer, n_ticks, y_min, y_max);
-    SetNextPlotTicksY(&buffer[0], n_ticks, labels, show_default,y_axis);
+    double* buffer = AllocFrame<double>(n_ticks);
+    const double step = (y_max - y_min) / (n_ticks - 1);
+    for (int i = 0; i < n_ticks; ++i)
+        buffer[i] = y_min + i * step;
+    SetNextPlotTicksY(buffer, n_ticks, labels, show_default,y_axis);
 }
 
 void SetPlotYAxis(int y_axis) {
@@ -2263,6 +2892,28 @@ void PopPlotClipRect() {
     ImGui::PopClipRect();
 }
 
+void SetGarbageCollectionAge(int max_frames, double max_seconds) {
+    ImPlotContext& gp = *GImPlot;
+    gp.Gc.MaxAgeFrames  = max_frames;
+    gp.Gc.MaxAgeSeconds = max_seconds;
+}
+
+void SetProfilerCallbacks(ImPlotProfilerCallback begin, ImPlotProfilerCallback end, void* user_data) {
+    GImPlotProfileBegin    = begin;
+    GImPlotProfileEnd      = end;
+    GImPlotProfileUserData = user_data;
+}
+
+void ProfileBegin(const char* name) {
+    if (GImPlotProfileBegin)
+        GImPlotProfileBegin(name, GImPlotProfileUserData);
+}
+
+void ProfileEnd(const char* name) {
+    if (GImPlotProfileEnd)
+        GImPlotProfileEnd(name, GImPlotProfileUserData);
+}
+
 bool IsPlotHovered() {
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "IsPlotHovered() needs to be called between BeginPlot() and EndPlot()!");
@@ -2426,6 +3077,367 @@ void EndLegendPopup() {
     ImGui::EndPopup();
 }
 
+//-----------------------------------------------------------------------------
+// OFFSCREEN RENDERING
+//-----------------------------------------------------------------------------
+
+// Alpha8 texture sampled by draw commands that reference the font atlas
+struct ImPlotRasterTexture {
+    ImTextureID          ID;
+    const unsigned char* Pixels;
+    int                  Width, Height;
+};
+
+static inline float SampleRasterTexture(const ImPlotRasterTexture* tex, const ImVec2& uv) {
+    if (tex == NULL)
+        return 1.0f;
+    const int x = ImClamp((int)(uv.x * tex->Width),  0, tex->Width  - 1);
+    const int y = ImClamp((int)(uv.y * tex->Height), 0, tex->Height - 1);
+    return tex->Pixels[y * tex->Width + x] * (1.0f / 255.0f);
+}
+
+// Blends a straight alpha color (all channels in [0,1]) over a RGBA8 pixel
+static inline void BlendRasterPixel(unsigned char* dst, float r, float g, float b, float a) {
+    if (a <= 0)
+        return;
+    const float ia = 1.0f - a;
+    dst[0] = (unsigned char)(255.0f * r * a + dst[0] * ia + 0.5f);
+    dst[1] = (unsigned char)(255.0f * g * a + dst[1] * ia + 0.5f);
+    dst[2] = (unsigned char)(255.0f * b * a + dst[2] * ia + 0.5f);
+    dst[3] = (unsigned char)(255.0f * a + dst[3] * ia + 0.5f);
+}
+
+// Fill convention for pixel centers lying exactly on an edge. An edge shared by two triangles is walked in opposite
+// directions by each, so exactly one of them owns it and translucent quads are not blended twice along their diagonal.
+static inline bool RasterEdgeOwnsTies(const ImVec2& a, const ImVec2& b) {
+    return b.y > a.y || (b.y == a.y && b.x > a.x);
+}
+
+static inline bool RasterEdgeInside(float e, bool owns_ties) {
+    return e > 0 || (e == 0 && owns_ties);
+}
+
+// Rasterizes one triangle into the pixels of the integer clip rect [x_min,x_max) x [y_min,y_max)
+static void RasterizeTriangle(const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, const ImVec2& offset, const ImVec2& scale,
+                              int x_min, int y_min, int x_max, int y_max, const ImPlotRasterTexture* tex, unsigned char* pixels, int width)
+{
+    ImVec2 p0((v0->pos.x - offset.x) * scale.x, (v0->pos.y - offset.y) * scale.y);
+    ImVec2 p1((v1->pos.x - offset.x) * scale.x, (v1->pos.y - offset.y) * scale.y);
+    ImVec2 p2((v2->pos.x - offset.x) * scale.x, (v2->pos.y - offset.y) * scale.y);
+    // pixels whose centers can lie inside the triangle
+    const int x0 = ImMax(x_min, (int)ImFloor(ImMin(p0.x, ImMin(p1.x, p2.x))));
+    const int y0 = ImMax(y_min, (int)ImFloor(ImMin(p0.y, ImMin(p1.y, p2.y))));
+    const int x1 = ImMin(x_max, (int)ImFloor(ImMax(p0.x, ImMax(p1.x, p2.x))) + 1);
+    const int y1 = ImMin(y_max, (int)ImFloor(ImMax(p0.y, ImMax(p1.y, p2.y))) + 1);
+    if (x0 >= x1 || y0 >= y1)
+        return;
+    float area = (p1.x - p0.x) * (p2.y - p0.y) - (p1.y - p0.y) * (p2.x - p0.x);
+    if (!(area > 0 || area < 0))
+        return;
+    // ImDrawList emits both windings, normalize so that the interior is where all edge functions are positive
+    if (area < 0) {
+        ImSwap(v1, v2);
+        ImSwap(p1, p2);
+        area = -area;
+    }
+    const float inv_area = 1.0f / area;
+    const bool  tie0 = RasterEdgeOwnsTies(p1, p2);
+    const bool  tie1 = RasterEdgeOwnsTies(p2, p0);
+    const bool  tie2 = RasterEdgeOwnsTies(p0, p1);
+    // solid geometry (the common case: fills, lines and markers all sample the atlas white pixel) needs no interpolation
+    const bool solid = v0->col == v1->col && v0->col == v2->col && v0->uv.x == v1->uv.x && v0->uv.x == v2->uv.x && v0->uv.y == v1->uv.y && v0->uv.y == v2->uv.y;
+    const ImVec4 c0 = ImGui::ColorConvertU32ToFloat4(v0->col);
+    const ImVec4 c1 = ImGui::ColorConvertU32ToFloat4(v1->col);
+    const ImVec4 c2 = ImGui::ColorConvertU32ToFloat4(v2->col);
+    const float solid_a = c0.w * SampleRasterTexture(tex, v0->uv);
+    for (int y = y0; y < y1; ++y) {
+        const float py = y + 0.5f;
+        // edge functions are evaluated directly rather than incrementally so that ties are exact
+        const float r0 = (p2.x - p1.x) * (py - p1.y);
+        const float r1 = (p0.x - p2.x) * (py - p2.y);
+        const float r2 = (p1.x - p0.x) * (py - p0.y);
+        unsigned char* row = pixels + ((size_t)y * width) * 4;
+        for (int x = x0; x < x1; ++x) {
+            const float px = x + 0.5f;
+            const float e0 = r0 - (p2.y - p1.y) * (px - p1.x);
+            const float e1 = r1 - (p0.y - p2.y) * (px - p2.x);
+            const float e2 = r2 - (p1.y - p0.y) * (px - p0.x);
+            if (!RasterEdgeInside(e0, tie0) || !RasterEdgeInside(e1, tie1) || !RasterEdgeInside(e2, tie2))
+                continue;
+            if (solid) {
+                BlendRasterPixel(row + x * 4, c0.x, c0.y, c0.z, solid_a);
+            }
+            else {
+                const float  l0 = e0 * inv_area, l1 = e1 * inv_area, l2 = e2 * inv_area;
+                const ImVec4 c(c0.x * l0 + c1.x * l1 + c2.x * l2, c0.y * l0 + c1.y * l1 + c2.y * l2,
+                               c0.z * l0 + c1.z * l1 + c2.z * l2, c0.w * l0 + c1.w * l1 + c2.w * l2);
+                const ImVec2 uv(v0->uv.x * l0 + v1->uv.x * l1 + v2->uv.x * l2, v0->uv.y * l0 + v1->uv.y * l1 + v2->uv.y * l2);
+                BlendRasterPixel(row + x * 4, c.x, c.y, c.z, c.w * SampleRasterTexture(tex, uv));
+            }
+        }
+    }
+}
+
+int GetRasterTileCount(int width, int height) {
+    return ((width + IMPLOT_RASTER_TILE_SIZE - 1) / IMPLOT_RASTER_TILE_SIZE) * ((height + IMPLOT_RASTER_TILE_SIZE - 1) / IMPLOT_RASTER_TILE_SIZE);
+}
+
+void RasterizeDrawData(const ImDrawData* draw_data, unsigned char* pixels, int width, int height, int tile_begin, int tile_end) {
+    IM_ASSERT_USER_ERROR(draw_data != NULL && draw_data->Valid, "RasterizeDrawData() needs valid draw data, e.g. from ImGui::GetDrawData() after ImGui::Render()!");
+    IM_ASSERT_USER_ERROR(pixels != NULL && width > 0 && height > 0, "RasterizeDrawData() needs a width x height x 4 byte pixel buffer!");
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    unsigned char* font_pixels;
+    ImPlotRasterTexture font;
+    font.ID = atlas->TexID;
+    atlas->GetTexDataAsAlpha8(&font_pixels, &font.Width, &font.Height);
+    font.Pixels = font_pixels;
+    const ImVec2 offset   = draw_data->DisplayPos;
+    const ImVec2 scale    = draw_data->FramebufferScale;
+    const int tiles_x     = (width + IMPLOT_RASTER_TILE_SIZE - 1) / IMPLOT_RASTER_TILE_SIZE;
+    const int tile_count  = GetRasterTileCount(width, height);
+    if (tile_end < 0 || tile_end > tile_count)
+        tile_end = tile_count;
+    for (int t = ImMax(tile_begin, 0); t < tile_end; ++t) {
+        const int tx0 = (t % tiles_x) * IMPLOT_RASTER_TILE_SIZE;
+        const int ty0 = (t / tiles_x) * IMPLOT_RASTER_TILE_SIZE;
+        const int tx1 = ImMin(tx0 + IMPLOT_RASTER_TILE_SIZE, width);
+        const int ty1 = ImMin(ty0 + IMPLOT_RASTER_TILE_SIZE, height);
+        // draw lists and commands are walked in submission order so blending matches a GPU backend
+        for (int l = 0; l < draw_data->CmdListsCount; ++l) {
+            const ImDrawList* draw_list = draw_data->CmdLists[l];
+            for (int c = 0; c < draw_list->CmdBuffer.Size; ++c) {
+                const ImDrawCmd& cmd = draw_list->CmdBuffer[c];
+                if (cmd.UserCallback != NULL)
+                    continue;
+                const int cx0 = ImMax(tx0, (int)ImFloor((cmd.ClipRect.x - offset.x) * scale.x));
+                const int cy0 = ImMax(ty0, (int)ImFloor((cmd.ClipRect.y - offset.y) * scale.y));
+                const int cx1 = ImMin(tx1, (int)ImFloor((cmd.ClipRect.z - offset.x) * scale.x));
+                const int cy1 = ImMin(ty1, (int)ImFloor((cmd.ClipRect.w - offset.y) * scale.y));
+                if (cx0 >= cx1 || cy0 >= cy1)
+                    continue;
+                const ImDrawVert* vtx = draw_list->VtxBuffer.Data + cmd.VtxOffset;
+                const ImDrawIdx*  idx = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+                const ImPlotRasterTexture* tex = cmd.TextureId == font.ID ? &font : NULL;
+                for (unsigned int i = 0; i + 2 < cmd.ElemCount; i += 3)
+                    RasterizeTriangle(&vtx[idx[i]], &vtx[idx[i+1]], &vtx[idx[i+2]], offset, scale, cx0, cy0, cx1, cy1, tex, pixels, width);
+            }
+        }
+    }
+}
+
+// Minimal zlib stream writer: a single deflate block with the fixed Huffman code and greedy LZ77 matching. Plot images
+// are dominated by flat runs, which the Up filter and distance 1/4 matches reduce to a few bits per row.
+struct ImPlotDeflateWriter {
+    ImPlotDeflateWriter(ImVector<unsigned char>& out) : Out(out), Bits(0), Count(0) { }
+    void Put(ImU32 value, int bits) {
+        Bits  |= value << Count;
+        Count += bits;
+        while (Count >= 8) {
+            Out.push_back((unsigned char)(Bits & 0xFF));
+            Bits  >>= 8;
+            Count -= 8;
+        }
+    }
+    // Huffman codes are packed starting from their most significant bit
+    void PutCode(ImU32 code, int bits) {
+        ImU32 rev = 0;
+        for (int i = 0; i < bits; ++i)
+            rev |= ((code >> i) & 1) << (bits - 1 - i);
+        Put(rev, bits);
+    }
+    void PutSymbol(int sym) {
+        if (sym < 144)      PutCode(0x30  + sym,       8);
+        else if (sym < 256) PutCode(0x190 + sym - 144, 9);
+        else if (sym < 280) PutCode(sym - 256,         7);
+        else                PutCode(0xC0  + sym - 280, 8);
+    }
+    void PutMatch(int len, int dist) {
+        static const unsigned short len_base[29]   = {3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258};
+        static const unsigned char  len_extra[29]  = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0};
+        static const unsigned short dist_base[30]  = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
+        static const unsigned char  dist_extra[30] = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
+        int l = 28;
+        while (len_base[l] > len) --l;
+        PutSymbol(257 + l);
+        Put(len - len_base[l], len_extra[l]);
+        int d = 29;
+        while (dist_base[d] > dist) --d;
+        PutCode(d, 5);
+        Put(dist - dist_base[d], dist_extra[d]);
+    }
+    void Flush() {
+        if (Count > 0)
+            Out.push_back((unsigned char)(Bits & 0xFF));
+        Bits = Count = 0;
+    }
+    ImVector<unsigned char>& Out;
+    ImU32 Bits;
+    int   Count;
+};
+
+static void PutBigEndian(ImVector<unsigned char>& out, ImU32 value) {
+    out.push_back((unsigned char)(value >> 24));
+    out.push_back((unsigned char)(value >> 16));
+    out.push_back((unsigned char)(value >> 8));
+    out.push_back((unsigned char)(value));
+}
+
+static void Deflate(const unsigned char* data, int size, ImVector<unsigned char>& out) {
+    const int window = 32768, hash_size = 1 << 15, max_len = 258;
+    out.push_back(0x78); // 32K window, deflate
+    out.push_back(0x01); // fastest compression level, no dictionary
+    ImPlotDeflateWriter writer(out);
+    writer.Put(1, 1); // final block
+    writer.Put(1, 2); // fixed Huffman code
+    ImVector<int> head;
+    head.resize(hash_size);
+    for (int h = 0; h < hash_size; ++h)
+        head[h] = -window - 1;
+    #define IMPLOT_DEFLATE_HASH(p) ((((ImU32)(p)[0] << 10) ^ ((ImU32)(p)[1] << 5) ^ (ImU32)(p)[2]) & (hash_size - 1))
+    int i = 0;
+    while (i < size) {
+        int best = 0;
+        if (i + 3 <= size) {
+            const ImU32 h = IMPLOT_DEFLATE_HASH(data + i);
+            const int cand = head[h];
+            head[h] = i;
+            if (i - cand <= window) {
+                const int limit = ImMin(max_len, size - i);
+                while (best < limit && data[cand + best] == data[i + best])
+                    ++best;
+                if (best >= 3)
+                    writer.PutMatch(best, i - cand);
+            }
+        }
+        if (best >= 3) {
+            for (int k = i + 1; k < i + best && k + 3 <= size; ++k)
+                head[IMPLOT_DEFLATE_HASH(data + k)] = k;
+            i += best;
+        }
+        else {
+            writer.PutSymbol(data[i++]);
+        }
+    }
+    #undef IMPLOT_DEFLATE_HASH
+    writer.PutSymbol(256); // end of block
+    writer.Flush();
+    // Adler-32 of the uncompressed data
+    ImU32 a = 1, b = 0;
+    for (int j = 0; j < size; ) {
+        const int end = ImMin(size, j + 5552); // largest run before the sums can overflow
+        for (; j < end; ++j) {
+            a += data[j];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    PutBigEndian(out, (b << 16) | a);
+}
+
+static void PutPngChunk(ImVector<unsigned char>& out, const char* type, const unsigned char* data, int size) {
+    PutBigEndian(out, (ImU32)size);
+    const int start = out.Size;
+    out.resize(out.Size + 4 + size);
+    memcpy(out.Data + start, type, 4);
+    if (size > 0)
+        memcpy(out.Data + start + 4, data, size);
+    // ImHashData is the standard CRC-32 when seeded with 0
+    PutBigEndian(out, ImHashData(out.Data + start, 4 + size, 0));
+}
+
+bool WritePNG(const char* filename, const unsigned char* pixels, int width, int height) {
+    IM_ASSERT_USER_ERROR(pixels != NULL && width > 0 && height > 0, "WritePNG() needs a width x height x 4 byte pixel buffer!");
+    const int stride = width * 4;
+    // scanlines use the Up filter (except the first), which turns horizontal structure like grid lines into zero runs
+    ImVector<unsigned char> filtered;
+    filtered.resize((stride + 1) * height);
+    for (int y = 0; y < height; ++y) {
+        const unsigned char* src  = pixels + (size_t)y * stride;
+        unsigned char*       dst  = filtered.Data + (size_t)y * (stride + 1);
+        dst[0] = y == 0 ? 0 : 2;
+        if (y == 0)
+            memcpy(dst + 1, src, stride);
+        else
+            for (int x = 0; x < stride; ++x)
+                dst[1 + x] = (unsigned char)(src[x] - src[x - stride]);
+    }
+    ImVector<unsigned char> png;
+    static const unsigned char signature[8] = {137, 'P', 'N', 'G', '\r', '\n', 26, '\n'};
+    png.resize(8);
+    memcpy(png.Data, signature, 8);
+    unsigned char ihdr[13];
+    ihdr[0] = (unsigned char)(width >> 24);  ihdr[1] = (unsigned char)(width >> 16);  ihdr[2]  = (unsigned char)(width >> 8);  ihdr[3] = (unsigned char)width;
+    ihdr[4] = (unsigned char)(height >> 24); ihdr[5] = (unsigned char)(height >> 16); ihdr[6]  = (unsigned char)(height >> 8); ihdr[7] = (unsigned char)height;
+    ihdr[8] = 8; // bit depth
+    ihdr[9] = 6; // RGBA
+    ihdr[10] = ihdr[11] = ihdr[12] = 0; // deflate, adaptive filtering, no interlace
+    PutPngChunk(png, "IHDR", ihdr, 13);
+    ImVector<unsigned char> idat;
+    Deflate(filtered.Data, filtered.Size, idat);
+    PutPngChunk(png, "IDAT", idat.Data, idat.Size);
+    PutPngChunk(png, "IEND", NULL, 0);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return false;
+    const bool ok = ImFileWrite(png.Data, 1, (ImU64)png.Size, f) == (ImU64)png.Size;
+    ImFileClose(f);
+    return ok;
+}
+
+bool RenderPlotToPNG(const char* filename, int width, int height, void (*render)(void* user_data), void* user_data) {
+    IM_ASSERT_USER_ERROR(render != NULL, "RenderPlotToPNG() needs a render callback!");
+    IM_ASSERT_USER_ERROR(width > 0 && height > 0, "RenderPlotToPNG() needs a positive image size!");
+    ImGuiContext*  prev_imgui  = ImGui::GetCurrentContext();
+    ImPlotContext* prev_implot = GImPlot;
+    // private contexts with their own font atlas, inheriting the caller's styles so that exports match the application
+    ImGuiContext* imgui_ctx = ImGui::CreateContext();
+    ImGui::SetCurrentContext(imgui_ctx);
+    if (prev_imgui != NULL)
+        ImGui::GetStyle() = prev_imgui->Style;
+    ImPlotContext* implot_ctx = CreateContext();
+    SetCurrentContext(implot_ctx);
+    if (prev_implot != NULL) {
+        implot_ctx->Style        = prev_implot->Style;
+        implot_ctx->Colormap     = prev_implot->Colormap;
+        implot_ctx->ColormapSize = prev_implot->ColormapSize;
+    }
+    ImGuiIO& io      = ImGui::GetIO();
+    io.IniFilename   = NULL;
+    io.DisplaySize   = ImVec2((float)width, (float)height);
+    io.DeltaTime     = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    unsigned char* tex_pixels;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsAlpha8(&tex_pixels, &tex_w, &tex_h);
+    // two frames, so that layout measured during the previous frame (legends, subplot padding) has settled
+    for (int frame = 0; frame < 2; ++frame) {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0,0));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0,0));
+        ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0);
+        ImGui::Begin("##RenderPlotToPNG", NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+        ImGui::PopStyleVar(2);
+        render(user_data);
+        ImGui::End();
+        ImGui::Render();
+    }
+    bool ok;
+    {
+        ImVector<unsigned char> pixels;
+        pixels.resize(width * height * 4);
+        memset(pixels.Data, 0, (size_t)pixels.Size);
+        RasterizeDrawData(ImGui::GetDrawData(), pixels.Data, width, height);
+        ok = WritePNG(filename, pixels.Data, width, height);
+    }
+    DestroyContext(implot_ctx);
+    ImGui::DestroyContext(imgui_ctx);
+    ImGui::SetCurrentContext(prev_imgui);
+    SetCurrentContext(prev_implot);
+    return ok;
+}
+
 //-----------------------------------------------------------------------------
 // STYLING
 //-----------------------------------------------------------------------------
@@ -2882,6 +3894,7 @@ void ShowStyleEditor(ImPlotStyle* ref) {
         if (ImGui::BeginTabItem("Variables")) {
             ImGui::Text("Item Styling");
             ImGui::SliderFloat("LineWeight", &style.LineWeight, 0.0f, 5.0f, "%.1f");
+            ImGui::Combo("LineJoin", &style.LineJoin, "None\0Miter\0Bevel\0");
             ImGui::SliderFloat("MarkerSize", &style.MarkerSize, 2.0f, 10.0f, "%.1f");
             ImGui::SliderFloat("MarkerWeight", &style.MarkerWeight, 0.0f, 5.0f, "%.1f");
             ImGui::SliderFloat("FillAlpha", &style.FillAlpha, 0.0f, 1.0f, "%.2f");
@@ -3109,6 +4122,69 @@ void ShowUserGuide() {
     ImGui::BulletText("Click legend label icons to show/hide plot items.");
 }
 
+static void MetricsText(const ImPlotMetrics& m) {
+    ImGui::Text("%.3f ms | %d points (%d culled) | %d vtx, %d idx | %d cmds", m.TimeMs, m.Points, m.Culled, m.Vertices, m.Indices, m.CmdSplits);
+}
+
+void ShowMetricsWindow(bool* p_open) {
+    ImPlotContext& gp = *GImPlot;
+    if (!ImGui::Begin("ImPlot Metrics", p_open)) {
+        ImGui::End();
+        return;
+    }
+    // plots and items only pay for metrics capture while this window is visible
+    gp.MetricsFrame = ImGui::GetFrameCount();
+    ImGui::Text("ImPlot %s", IMPLOT_VERSION);
+    ImGui::Text("Plots: %d live, %d evicted", gp.Gc.PlotsLive, gp.Gc.PlotsEvicted);
+    ImGui::Text("Items: %d live, %d evicted", gp.Gc.ItemsLive, gp.Gc.ItemsEvicted);
+    ImGui::Text("Text Size Cache: %d entries, %.1f%% hits", gp.TextSizeCache.Entries.Size, 100 * gp.TextSizeCache.HitRate());
+    ImGui::Text("Frame Arena: %d B peak, %d blocks", gp.FrameArena.HighWater, gp.FrameArena.HeapAllocs);
+    ImGui::Separator();
+    ImGui::Checkbox("Show Vertices", &gp.MetricsShowVtx);
+    SetNextPlotLimitsX(0, IMPLOT_METRICS_HISTORY, ImGuiCond_Always);
+    FitNextPlotAxes(false, true, false, false);
+    if (BeginPlot("##MetricsHistory", "Frame", gp.MetricsShowVtx ? "Vertices" : "CPU Time (ms)", ImVec2(-1,200), ImPlotFlags_NoMenus)) {
+        for (int i = 0; i < gp.Plots.Map.Data.Size; ++i) {
+            const int idx = gp.Plots.Map.Data[i].val_i;
+            if (idx == -1)
+                continue;
+            ImPlotState& plot = *gp.Plots.GetByIndex(idx);
+            if (&plot == gp.CurrentPlot)
+                continue;
+            ImGui::PushID(idx);
+            PlotLine(plot.DebugName[0] != '#' ? plot.DebugName : "Untitled", gp.MetricsShowVtx ? plot.VtxHistory : plot.TimeHistory, IMPLOT_METRICS_HISTORY, plot.HistoryOffset);
+            ImGui::PopID();
+        }
+        EndPlot();
+    }
+    for (int i = 0; i < gp.Plots.Map.Data.Size; ++i) {
+        const int idx = gp.Plots.Map.Data[i].val_i;
+        if (idx == -1)
+            continue;
+        ImPlotState& plot = *gp.Plots.GetByIndex(idx);
+        if (ImGui::TreeNode((void*)(size_t)idx, "Plot '%s' (%.3f ms, %d items)", plot.DebugName, plot.Metrics.TimeMs, plot.Items.Map.Data.Size)) {
+            ImGui::Text("Last Frame Seen: %d", plot.LastFrameSeen);
+            MetricsText(plot.Metrics);
+            for (int j = 0; j < plot.Items.Map.Data.Size; ++j) {
+                const int item_idx = plot.Items.Map.Data[j].val_i;
+                if (item_idx == -1)
+                    continue;
+                ImPlotItem& item = *plot.Items.GetByIndex(item_idx);
+                ImGui::PushID(item_idx);
+                ImGui::ColorButton("##Color", item.Color, ImGuiColorEditFlags_NoTooltip | ImGuiColorEditFlags_NoInputs, ImVec2(ImGui::GetTextLineHeight(), ImGui::GetTextLineHeight()));
+                ImGui::SameLine();
+                ImGui::Text("'%s'%s", item.DebugName, item.Show ? "" : " (hidden)");
+                ImGui::Indent();
+                MetricsText(item.Metrics);
+                ImGui::Unindent();
+                ImGui::PopID();
+            }
+            ImGui::TreePop();
+        }
+    }
+    ImGui::End();
+}
+
 void StyleColorsAuto(ImPlotStyle* dst) {
     ImPlotStyle* style              = dst ? dst : &ImPlot::GetStyle();
     ImVec4* colors                  = style->Colors;
@@ -45,12 +45,19 @@ struct ImPlotContext;          // ImPlot context (opaque struct, see implot_inte
 
 // Enums/Flags
 typedef int ImPlotFlags;       // -> enum ImPlotFlags_
+typedef int ImPlotSubplotFlags; // -> enum ImPlotSubplotFlags_
 typedef int ImPlotAxisFlags;   // -> enum ImPlotAxisFlags_
 typedef int ImPlotCol;         // -> enum ImPlotCol_
 typedef int ImPlotStyleVar;    // -> enum ImPlotStyleVar_
 typedef int ImPlotMarker;      // -> enum ImPlotMarker_
+typedef int ImPlotLineJoin;    // -> enum ImPlotLineJoin_
+typedef int ImPlotBin;         // -> enum ImPlotBin_
+typedef int ImPlotHistogramFlags; // -> enum ImPlotHistogramFlags_
 typedef int ImPlotColormap;    // -> enum ImPlotColormap_
 
+// Callbacks
+typedef void (*ImPlotProfilerCallback)(const char* name, void* user_data); // -> SetProfilerCallbacks()
+
 // Options for plots.
 enum ImPlotFlags_ {
     ImPlotFlags_None          = 0,       // default
@@ -65,9 +72,22 @@ enum ImPlotFlags_ {
     ImPlotFlags_Query         = 1 << 8,  // the user will be able to draw query rects with middle-mouse
     ImPlotFlags_Crosshairs    = 1 << 9,  // the default mouse cursor will be replaced with a crosshair when hovered
     ImPlotFlags_AntiAliased   = 1 << 10, // plot lines will be software anti-aliased (not recommended for density plots, prefer MSAA)
+    ImPlotFlags_ScrollLegend  = 1 << 11, // the legend will be clipped to the plot area and scrolled with the mouse wheel; only visible entries are measured and drawn (recommended for plots with many items)
+    ImPlotFlags_Sparkline     = 1 << 12, // lightweight mode for tiny plots (e.g. in table cells): only the frame and items are drawn; the child window, input, ticks, labels, legend, menus, mouse text and metrics capture are skipped
     ImPlotFlags_CanvasOnly    = ImPlotFlags_NoLegend | ImPlotFlags_NoMenus | ImPlotFlags_NoBoxSelect | ImPlotFlags_NoMousePos
 };
 
+// Options for subplot grids.
+enum ImPlotSubplotFlags_ {
+    ImPlotSubplotFlags_None     = 0,      // default
+    ImPlotSubplotFlags_NoTitle  = 1 << 0, // the subplot title will not be displayed
+    ImPlotSubplotFlags_NoAlign  = 1 << 1, // the plot areas of cells in the same row/column will not be aligned (each cell sizes its own axis gutters)
+    ImPlotSubplotFlags_LinkRows = 1 << 2, // the y-axis limits of cells in the same row will be linked and share tick labels
+    ImPlotSubplotFlags_LinkCols = 1 << 3, // the x-axis limits of cells in the same column will be linked and share tick labels
+    ImPlotSubplotFlags_LinkAllX = 1 << 4, // the x-axis limits of every cell will be linked and share tick labels
+    ImPlotSubplotFlags_LinkAllY = 1 << 5, // the y-axis limits of every cell will be linked and share tick labels
+};
+
 // Options for plot axes (X and Y).
 enum ImPlotAxisFlags_ {
     ImPlotAxisFlags_None          = 0,      // default
@@ -118,6 +138,7 @@ enum ImPlotCol_ {
 enum ImPlotStyleVar_ {
     // item styling variables
     ImPlotStyleVar_LineWeight,       // float,  plot item line weight in pixels
+    ImPlotStyleVar_LineJoin,         // int,    line join specification
     ImPlotStyleVar_Marker,           // int,    marker specification
     ImPlotStyleVar_MarkerSize,       // float,  marker size in pixels (roughly the marker's "radius")
     ImPlotStyleVar_MarkerWeight,     // float,  plot outline weight of markers in pixels
@@ -159,6 +180,30 @@ enum ImPlotMarker_ {
     ImPlotMarker_COUNT
 };
 
+// Line join specifications (how consecutive segments of a line are connected, ignored for anti-aliased lines).
+enum ImPlotLineJoin_ {
+    ImPlotLineJoin_None = 0, // segments are rendered independently (default, may show gaps at the corners of thick lines)
+    ImPlotLineJoin_Miter,    // segments share vertices and are joined with a miter (fewest vertices for long lines)
+    ImPlotLineJoin_Bevel,    // segments share vertices and are joined with a bevel
+    ImPlotLineJoin_COUNT
+};
+
+// Automatic histogram binning rules (pass in place of an explicit bin count).
+enum ImPlotBin_ {
+    ImPlotBin_Sturges          = -1, // k = log2(n) + 1 (default, suited for roughly normal data)
+    ImPlotBin_Scott            = -2, // w = 3.49 * sigma / n^(1/3)
+    ImPlotBin_FreedmanDiaconis = -3  // w = 2 * IQR / n^(1/3) (robust to outliers)
+};
+
+// Options for histograms.
+enum ImPlotHistogramFlags_ {
+    ImPlotHistogramFlags_None       = 0,      // default
+    ImPlotHistogramFlags_Cumulative = 1 << 0, // each bin will contain its count plus the counts of all previous bins
+    ImPlotHistogramFlags_Density    = 1 << 1, // counts will be normalized to form a probability density (area of 1, or 1 at the last bin if cumulative)
+    ImPlotHistogramFlags_NoCache    = 1 << 2, // values will be rebinned every frame (use if the data changes in place)
+    ImPlotHistogramFlags_Visible    = 1 << 3, // only the visible range of the axes will be binned, rebinning as they are panned or zoomed (PlotHistogram2D only)
+};
+
 // Built-in colormaps
 enum ImPlotColormap_ {
     ImPlotColormap_Default  = 0,  // ImPlot default colormap         (n=10)
@@ -204,10 +249,53 @@ struct ImPlotLimits {
     bool Contains(double x, double y) const   { return X.Contains(x) && Y.Contains(y); }
 };
 
+// Summary of the points selected by QueryPoints. Min, Max and Mean are NAN if no point is selected.
+struct ImPlotQuerySummary {
+    int         Count; // number of selected points
+    ImPlotPoint Min;   // per-axis minimum of the selected points
+    ImPlotPoint Max;   // per-axis maximum of the selected points
+    ImPlotPoint Mean;  // per-axis mean of the selected points
+    ImPlotQuerySummary();
+};
+
+// Run-length encoded digital channel, storing only the transitions of a signal (see PlotDigital). Owned and reused by the user.
+struct ImPlotDigitalChannel {
+    ImVector<double> Times;   // ascending transition times
+    ImVector<float>  States;  // state entered at each transition
+    double           EndTime; // time until which the last state is held (unused while the channel is empty)
+
+    ImPlotDigitalChannel() { EndTime = 0; }
+    // Removes all transitions.
+    void Clear() { Times.resize(0); States.resize(0); EndTime = 0; }
+    // Appends a transition at #time, or only extends the channel if #state equals the current state. Times must be ascending.
+    void AddTransition(double time, float state);
+    // Holds the last state until #time. Has no effect on an empty channel.
+    void Extend(double time) { if (Times.Size > 0 && time > EndTime) EndTime = time; }
+    // Rebuilds the channel from dense samples, keeping only the samples where the state changes.
+    void Build(const float* xs, const float* ys, int count, int offset = 0, int stride = sizeof(float));
+    void Build(const double* xs, const double* ys, int count, int offset = 0, int stride = sizeof(double));
+};
+
+// One series drawn by PlotSparklines: #Count values spread across a cell given in screen space. Filled by the user.
+struct ImPlotSparkline {
+    const float* Values;  // values, plotted against their index
+    int          Count;   // number of values
+    int          Offset;  // ring buffer offset of the first value
+    int          Stride;  // stride of the values in bytes
+    float        YMin;    // value mapped to the bottom of the cell (the data range is used if YMin >= YMax)
+    float        YMax;    // value mapped to the top of the cell
+    ImVec2       CellMin; // top-left corner of the cell in screen space
+    ImVec2       CellMax; // bottom-right corner of the cell in screen space
+    ImVec4       Color;   // line color, or IMPLOT_AUTO_COL to use the current colormap
+
+    ImPlotSparkline() { Values = NULL; Count = Offset = 0; Stride = sizeof(float); YMin = YMax = 0; CellMin = CellMax = ImVec2(0,0); Color = IMPLOT_AUTO_COL; }
+};
+
 // Plot style structure
 struct ImPlotStyle {
     // item styling variables
     float   LineWeight;              // = 1,      item line weight in pixels
+    int     LineJoin;                // = ImPlotLineJoin_None, line join specification
     int     Marker;                  // = ImPlotMarker_None, marker specification
     float   MarkerSize;              // = 4,      marker size in pixels (roughly the marker's "radius")
     float   MarkerWeight;            // = 1,      outline weight of markers in pixels
@@ -297,6 +385,36 @@ bool BeginPlot(const char* title_id,
 // of an if statement conditioned on BeginPlot().
 void EndPlot();
 
+//-----------------------------------------------------------------------------
+// Begin/End Subplots
+//-----------------------------------------------------------------------------
+
+// Starts a grid of #rows x #cols plots sharing a single child window. If this
+// function returns true, EndSubplots() must be called. Between the two, each
+// call to BeginPlot() occupies the next cell in row-major order (its #size and
+// ImPlotFlags_NoChild are ignored). Cells in the same row/column have their plot
+// areas aligned, and linked cells share a single tick computation per row/column.
+bool BeginSubplots(const char* title_id,
+                   int rows,
+                   int cols,
+                   const ImVec2& size       = ImVec2(-1,0),
+                   ImPlotSubplotFlags flags = ImPlotSubplotFlags_None);
+
+// Only call EndSubplots() if BeginSubplots() returns true!
+void EndSubplots();
+
+//-----------------------------------------------------------------------------
+// Sparkline Tables
+//-----------------------------------------------------------------------------
+
+// Renders many sparklines (e.g. one per table row) in a single pass without BeginPlot/EndPlot. Each line is filled down
+// to the bottom of its cell with #fill_alpha. Consecutive sparklines whose cells share the same vertical extent form a
+// row that is rendered under a single clip rect. Call this outside of Begin/EndPlot but while the window holding the cells
+// is still current, i.e. inside the table just before EndTable (a scrolling table has its own child window), with the cell
+// rects collected while building it. Rows are clipped to that window's inner clip rect. If #draw_list is NULL, that
+// window's draw list is used.
+void PlotSparklines(const ImPlotSparkline* sparklines, int count, float fill_alpha = 0.25f, ImDrawList* draw_list = NULL);
+
 //-----------------------------------------------------------------------------
 // Plot Items
 //-----------------------------------------------------------------------------
@@ -319,6 +437,26 @@ void PlotScatter(const char* label_id, const ImVec2* data, int count, int offset
 void PlotScatter(const char* label_id, const ImPlotPoint* data, int count, int offset = 0);
 void PlotScatter(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset = 0);
 
+// Plots a scatter density for very large point clouds. Points are binned into a screen space grid of #bin_size pixel cells
+// (hexagons of radius #bin_size if #hexagonal) at the current zoom, and each non-empty bin is colored by its count on a
+// log scale using the current colormap.
+void PlotScatterDensity(const char* label_id, const float* xs, const float* ys, int count, float bin_size = 4, bool hexagonal = false, int offset = 0, int stride = sizeof(float));
+void PlotScatterDensity(const char* label_id, const double* xs, const double* ys, int count, float bin_size = 4, bool hexagonal = false, int offset = 0, int stride = sizeof(double));
+
+// Adds #count partial bin counts into #counts. The Count*Range functions count only the samples [#begin, #end) into an array
+// you own, so very large data sets can be spread over your own worker threads: give each worker a zeroed partial array and a
+// disjoint range, merge the arrays with MergeBinCounts, then draw the result with the matching Plot*Counts function.
+void MergeBinCounts(int* counts, const int* partial, int count);
+
+// Range based scatter density (see MergeBinCounts). Must be called between BeginPlot and EndPlot, since bins are in screen
+// space: the grid has GetScatterDensityBins() counts and is only valid for the axes of the current frame. The workers only
+// read the current plot, so wait for them before submitting anything else. Use the same #bin_size and #hexagonal throughout.
+// PlotScatterDensityCounts does not fit the axes.
+int  GetScatterDensityBins(float bin_size = 4, bool hexagonal = false);
+void CountScatterDensityRange(const float* xs, const float* ys, int begin, int end, int* counts, float bin_size = 4, bool hexagonal = false, int stride = sizeof(float));
+void CountScatterDensityRange(const double* xs, const double* ys, int begin, int end, int* counts, float bin_size = 4, bool hexagonal = false, int stride = sizeof(double));
+void PlotScatterDensityCounts(const char* label_id, const int* counts, float bin_size = 4, bool hexagonal = false);
+
 // Plots a shaded (filled) region between two lines, or a line and a horizontal reference.
 void PlotShaded(const char* label_id, const float* values, int count, float y_ref = 0, int offset = 0, int stride = sizeof(float));
 void PlotShaded(const char* label_id, const double* values, int count, double y_ref = 0, int offset = 0, int stride = sizeof(double));
@@ -360,6 +498,49 @@ void PlotStems(const char* label_id, const double* values, int count, double y_r
 void PlotStems(const char* label_id, const float* xs, const float* ys, int count, float y_ref = 0, int offset = 0, int stride = sizeof(float));
 void PlotStems(const char* label_id, const double* xs, const double* ys, int count, double y_ref = 0, int offset = 0, int stride = sizeof(double));
 
+// Plots a histogram of raw samples. #bins can be a bin count or an ImPlotBin_ rule. If #range is left unspecified, the min/max of the data is used.
+// Results are cached per item and only recomputed when the data pointer, count, or settings change. Returns the height of the tallest bin.
+double PlotHistogram(const char* label_id, const float* values, int count, int bins = ImPlotBin_Sturges, ImPlotHistogramFlags flags = 0, ImPlotRange range = ImPlotRange(), int stride = sizeof(float));
+double PlotHistogram(const char* label_id, const double* values, int count, int bins = ImPlotBin_Sturges, ImPlotHistogramFlags flags = 0, ImPlotRange range = ImPlotRange(), int stride = sizeof(double));
+double PlotHistogram(const char* label_id, const int* values, int count, int bins = ImPlotBin_Sturges, ImPlotHistogramFlags flags = 0, ImPlotRange range = ImPlotRange(), int stride = sizeof(int));
+
+// Plots a histogram of raw samples with explicit bin edges (#edge_count ascending edges define #edge_count-1 bins). Returns the height of the tallest bin.
+double PlotHistogram(const char* label_id, const float* values, int count, const double* edges, int edge_count, ImPlotHistogramFlags flags = 0, int stride = sizeof(float));
+double PlotHistogram(const char* label_id, const double* values, int count, const double* edges, int edge_count, ImPlotHistogramFlags flags = 0, int stride = sizeof(double));
+double PlotHistogram(const char* label_id, const int* values, int count, const double* edges, int edge_count, ImPlotHistogramFlags flags = 0, int stride = sizeof(int));
+
+// Range based histograms (see MergeBinCounts), counted into #bins uniform bins over a finite #range or between #edge_count
+// ascending edges. PlotHistogramCounts normalizes the counts per #flags and returns the height of the tallest bin.
+void CountHistogramRange(const float* values, int begin, int end, int* counts, int bins, ImPlotRange range, int stride = sizeof(float));
+void CountHistogramRange(const double* values, int begin, int end, int* counts, int bins, ImPlotRange range, int stride = sizeof(double));
+void CountHistogramRange(const int* values, int begin, int end, int* counts, int bins, ImPlotRange range, int stride = sizeof(int));
+void CountHistogramRange(const float* values, int begin, int end, int* counts, const double* edges, int edge_count, int stride = sizeof(float));
+void CountHistogramRange(const double* values, int begin, int end, int* counts, const double* edges, int edge_count, int stride = sizeof(double));
+void CountHistogramRange(const int* values, int begin, int end, int* counts, const double* edges, int edge_count, int stride = sizeof(int));
+double PlotHistogramCounts(const char* label_id, const int* counts, int bins, ImPlotRange range, ImPlotHistogramFlags flags = 0);
+double PlotHistogramCounts(const char* label_id, const int* counts, const double* edges, int edge_count, ImPlotHistogramFlags flags = 0);
+
+// Plots a 2D histogram of raw xs/ys samples as a heatmap. #x_bins and #y_bins can be bin counts or ImPlotBin_ rules. If #range is left unspecified,
+// the min/max of the data is used. ImPlotHistogramFlags_Cumulative is ignored. Results are cached like PlotHistogram. Returns the height of the tallest bin.
+double PlotHistogram2D(const char* label_id, const float* xs, const float* ys, int count, int x_bins = 10, int y_bins = 10, ImPlotHistogramFlags flags = 0, ImPlotLimits range = ImPlotLimits(), int stride = sizeof(float));
+double PlotHistogram2D(const char* label_id, const double* xs, const double* ys, int count, int x_bins = 10, int y_bins = 10, ImPlotHistogramFlags flags = 0, ImPlotLimits range = ImPlotLimits(), int stride = sizeof(double));
+double PlotHistogram2D(const char* label_id, const int* xs, const int* ys, int count, int x_bins = 10, int y_bins = 10, ImPlotHistogramFlags flags = 0, ImPlotLimits range = ImPlotLimits(), int stride = sizeof(int));
+
+// Range based 2D histograms (see MergeBinCounts), counted into a row major grid of #x_bins * #y_bins counts whose first row is the
+// top of #range. PlotHistogram2DCounts normalizes the counts per #flags and returns the height of the tallest bin.
+void CountHistogram2DRange(const float* xs, const float* ys, int begin, int end, int* counts, int x_bins, int y_bins, ImPlotLimits range, int stride = sizeof(float));
+void CountHistogram2DRange(const double* xs, const double* ys, int begin, int end, int* counts, int x_bins, int y_bins, ImPlotLimits range, int stride = sizeof(double));
+void CountHistogram2DRange(const int* xs, const int* ys, int begin, int end, int* counts, int x_bins, int y_bins, ImPlotLimits range, int stride = sizeof(int));
+double PlotHistogram2DCounts(const char* label_id, const int* counts, int x_bins, int y_bins, ImPlotLimits range, ImPlotHistogramFlags flags = 0);
+
+// Plots OHLC candlesticks. xs are candle times in UNIX seconds (sorted ascending), and bodies span #width_percent of the candle pitch.
+// When candles are packed tighter than a few pixels, they are aggregated into natural time buckets (e.g. 5 minutes, 1 hour, 1 week).
+// A bucket takes the open of its first candle, the close of its last, the lowest low and the highest high.
+void PlotCandlestick(const char* label_id, const double* xs, const double* opens, const double* closes, const double* lows, const double* highs, int count, float width_percent = 0.5f, const ImVec4& bull_col = ImVec4(0,1,0,1), const ImVec4& bear_col = ImVec4(1,0,0,1));
+// Discards the aggregated candles of #label_id in the current plot, e.g. after editing its data in place. Aggregates are otherwise
+// rebuilt when the data pointers, count, first time or last candle change.
+void BustCandleCache(const char* label_id);
+
 // Plots a pie chart. If the sum of values > 1 or normalize is true, each value will be normalized. Center and radius are in plot units. #label_fmt can be set to NULL for no labels.
 void PlotPieChart(const char** label_ids, const float* values, int count, float x, float y, float radius, bool normalize = false, const char* label_fmt = "%.1f", float angle0 = 90);
 void PlotPieChart(const char** label_ids, const double* values, int count, double x, double y, double radius, bool normalize = false, const char* label_fmt = "%.1f", double angle0 = 90);
@@ -368,10 +549,13 @@ void PlotPieChart(const char** label_ids, const double* values, int count, doubl
 void PlotHeatmap(const char* label_id, const float* values, int rows, int cols, float scale_min, float scale_max, const char* label_fmt = "%.1f", const ImPlotPoint& bounds_min = ImPlotPoint(0,0), const ImPlotPoint& bounds_max = ImPlotPoint(1,1));
 void PlotHeatmap(const char* label_id, const double* values, int rows, int cols, double scale_min, double scale_max, const char* label_fmt = "%.1f", const ImPlotPoint& bounds_min = ImPlotPoint(0,0), const ImPlotPoint& bounds_max = ImPlotPoint(1,1));
 
-// Plots digital data. Digital plots do not respond to y drag or zoom, and are always referenced to the bottom of the plot.
+// Plots digital data. Digital plots do not respond to y drag or zoom, and are always referenced to the bottom of the plot. Each sample holds its value
+// until the next one, so xs must be sorted in ascending order. Runs narrower than a pixel are drawn as a translucent "busy" band.
 void PlotDigital(const char* label_id, const float* xs, const float* ys, int count, int offset = 0, int stride = sizeof(float));
 void PlotDigital(const char* label_id, const double* xs, const double* ys, int count, int offset = 0, int stride = sizeof(double));
 void PlotDigital(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset = 0);
+// Plots a run-length encoded digital channel. Rendering cost is proportional to the visible transitions rather than the samples they encode.
+void PlotDigital(const char* label_id, const ImPlotDigitalChannel& channel);
 
 // Plots a centered text label at point x,y with optional pixel offset. Text color can be changed with ImPlot::PushStyleColor(ImPlotCol_InlayText, ...).
 void PlotText(const char* text, float x, float y, bool vertical = false, const ImVec2& pixel_offset = ImVec2(0,0));
@@ -389,6 +573,13 @@ void SetNextPlotLimitsX(double xmin, double xmax, ImGuiCond cond = ImGuiCond_Onc
 void SetNextPlotLimitsY(double ymin, double ymax, ImGuiCond cond = ImGuiCond_Once, int y_axis = 0);
 // Links the next plot limits to external values. Set to NULL for no linkage. The pointer data must remain valid until the matching call EndPlot.
 void LinkNextPlotLimits(double* xmin, double* xmax, double* ymin, double* ymax, double* ymin2 = NULL, double* ymax2 = NULL, double* ymin3 = NULL, double* ymax3 = NULL);
+// Links the axes of the next plot to named link groups (NULL for no link). Axes in the same group share their limits
+// without any user storage, and changes are published to the group as soon as they are made, so plots begun later in
+// the same frame never lag behind. Groups are global to the context, so plots in different windows can share them.
+void LinkNextPlotAxes(const char* x_group, const char* y_group = NULL, const char* y2_group = NULL, const char* y3_group = NULL);
+// Returns the change generation of a link group, which only increments when the group's limits actually change (0 if
+// the group does not exist yet). Compare it to a stored value to invalidate caches that depend on the linked limits.
+int GetLinkGroupGeneration(const char* group);
 // Fits the next plot axes to all plotted data if they are unlocked (equivalent to double-clicks).
 void FitNextPlotAxes(bool x = true, bool y = true, bool y2 = true, bool y3 = true);
 
@@ -436,6 +627,24 @@ ImPlotLimits GetPlotLimits(int y_axis = IMPLOT_AUTO);
 bool IsPlotQueried();
 // Returns the current plot query bounds.
 ImPlotLimits GetPlotQuery(int y_axis = IMPLOT_AUTO);
+// Finds the point of a plotted item nearest to the mouse, within #radius pixels. Returns its index into xs/ys (or -1 if none
+// is in range or the item is hidden) and optionally stores it in #point. Uses the current y-axis. Sorted xs are binary
+// searched; otherwise a spatial grid is built on the first query and kept until the data pointers, count or layout change.
+int FindNearestPoint(const char* label_id, const float* xs, const float* ys, int count, float radius = 10, ImPlotPoint* point = NULL, int offset = 0, int stride = sizeof(float));
+int FindNearestPoint(const char* label_id, const double* xs, const double* ys, int count, float radius = 10, ImPlotPoint* point = NULL, int offset = 0, int stride = sizeof(double));
+// Discards the index kept by FindNearestPoint for an item of the current plot, so the next query rebuilds it. Call this
+// whenever the item's data changes in place (the index only tracks the data pointers, count and layout).
+void BustHitIndex(const char* label_id);
+// Selects the points of xs/ys inside #rect (e.g. GetPlotQuery()), appending their indices to #indices if it is not NULL, and
+// returns their count/min/max/mean. Pass #sorted_x if xs are ascending to binary search the x bounds. Can be called anywhere.
+ImPlotQuerySummary QueryPoints(const ImPlotLimits& rect, const float* xs, const float* ys, int count, ImVector<int>* indices = NULL, bool sorted_x = false, int offset = 0, int stride = sizeof(float));
+ImPlotQuerySummary QueryPoints(const ImPlotLimits& rect, const double* xs, const double* ys, int count, ImVector<int>* indices = NULL, bool sorted_x = false, int offset = 0, int stride = sizeof(double));
+// Range based selection, for spreading queries over very large data sets across your own worker threads. Each worker selects the
+// points of a disjoint range [#begin, #end) of raw indices into xs/ys with QueryPointsRange, appending to its own #indices if
+// not NULL. Combine the partial summaries with MergeQuerySummaries (and concatenate the index lists in range order).
+ImPlotQuerySummary QueryPointsRange(const ImPlotLimits& rect, const float* xs, const float* ys, int begin, int end, ImVector<int>* indices = NULL, int stride = sizeof(float));
+ImPlotQuerySummary QueryPointsRange(const ImPlotLimits& rect, const double* xs, const double* ys, int begin, int end, ImVector<int>* indices = NULL, int stride = sizeof(double));
+ImPlotQuerySummary MergeQuerySummaries(const ImPlotQuerySummary& a, const ImPlotQuerySummary& b);
 
 //-----------------------------------------------------------------------------
 // Plot and Item Styling
@@ -560,12 +769,46 @@ void PushPlotClipRect();
 // Pop plot clip rect.
 void PopPlotClipRect();
 
+// Frees the state of plots, items, subplot grids and axis link groups that have not been submitted for longer than
+// #max_frames frames and #max_seconds seconds (a threshold <= 0 is ignored; both are disabled by default). Use this in
+// long-running applications whose plot titles or item labels change over time (e.g. run numbers) so that stale state
+// does not accumulate.
+void SetGarbageCollectionAge(int max_frames, double max_seconds);
+
+// Sets callbacks invoked when ImPlot enters and leaves its hot path scopes (BeginPlot input handling, tick generation,
+// each PlotX call, fitting, rendering and EndPlot legend/overlay drawing), e.g. to forward them to a tracing profiler.
+// Scopes are named "ImPlot::..." and nest. Only has an effect if ImPlot is compiled with IMPLOT_ENABLE_PROFILER defined.
+void SetProfilerCallbacks(ImPlotProfilerCallback begin, ImPlotProfilerCallback end, void* user_data = NULL);
+
 // Shows ImPlot style selector dropdown menu.
 bool ShowStyleSelector(const char* label);
 // Shows ImPlot style editor block (not a window).
 void ShowStyleEditor(ImPlotStyle* ref = NULL);
 // Add basic help/info block (not a window): how to manipulate ImPlot as an end-user.
 void ShowUserGuide();
+// Shows ImPlot metrics/debug window: per plot and per item CPU time, points, culling and draw list output. Metrics are
+// only captured while this window is visible, so plots pay nothing for them otherwise.
+void ShowMetricsWindow(bool* p_open = NULL);
+
+//-----------------------------------------------------------------------------
+// Offscreen Rendering
+//-----------------------------------------------------------------------------
+
+// Renders the plots submitted by #render in a private, headless ImGui/ImPlot context at #width x #height pixels with
+// the software rasterizer and writes the image to #filename as a PNG. No window, GPU or renderer backend is required.
+// #render is called inside a window covering the image (e.g. call BeginPlot with size ImVec2(-1,-1) to fill it), and
+// the current ImGui and ImPlot styles and colormap are used. Returns false if the file could not be written.
+bool RenderPlotToPNG(const char* filename, int width, int height, void (*render)(void* user_data), void* user_data = NULL);
+// Rasterizes #draw_data (e.g. ImGui::GetDrawData() after ImGui::Render()) on the CPU into #pixels, a #width x #height
+// RGBA8 buffer, blending over its current contents. Commands using the current context's font atlas texture sample its
+// Alpha8 data and other textures are drawn as solid color. The image is split into 64x64 tiles that are independent:
+// pass the range [#tile_begin, #tile_end) to rasterize only those tiles, e.g. to spread GetRasterTileCount() tiles
+// over your own worker threads, or keep the defaults to rasterize the whole image.
+void RasterizeDrawData(const ImDrawData* draw_data, unsigned char* pixels, int width, int height, int tile_begin = 0, int tile_end = -1);
+// Returns the number of tiles RasterizeDrawData splits a #width x #height image into.
+int GetRasterTileCount(int width, int height);
+// Writes a #width x #height RGBA8 image to #filename as a PNG. Returns false if the file could not be written.
+bool WritePNG(const char* filename, const unsigned char* pixels, int width, int height);
 
 //-----------------------------------------------------------------------------
 // Demo (add implot_demo.cpp to your sources!)
@@ -573,5 +816,28 @@ void ShowUserGuide();
 
 // Shows the ImPlot demo.
 void ShowDemoWindow(bool* p_open = NULL);
+// Runs scripted benchmark scenarios (lines, scatter, shaded, bars, heatmap, digital, time and log axes) for #frames frames
+// each in a private, headless ImGui/ImPlot context and appends the results to #json_out as JSON. Scenarios whose total
+// point count exceeds #max_points are skipped. No window or renderer backend is required, so this can be run in CI.
+// The "sparklines" results time 1000 tiny plots per frame with and without ImPlotFlags_Sparkline (the lightweight mode
+// targets a fixed overhead below 2 us per plot), and the "micro" results time each Getter, Transformer and primitive
+// renderer in isolation for various strides and offsets (only if ImPlot is compiled with IMPLOT_ENABLE_BENCHMARKS
+// defined, otherwise "micro" is null).
+// To also report allocations per frame, pass a counter that your ImGui allocator (see ImGui::SetAllocatorFunctions)
+// increments as #alloc_count; otherwise "allocs_per_frame" is null. The allocator itself is never changed.
+void RunHeadlessBenchmark(ImGuiTextBuffer* json_out, int frames = 10, int max_points = 1000000, const int* alloc_count = NULL);
+// Renders scripted plots covering every item type, data layout (strides, ring buffer offsets), log axes and the 16-bit
+// ImDrawIdx wraparound path in a private, headless context, and appends a hash of each item's vertex, index and command
+// output to #json_out as JSON. Returns the combined hash, which can be compared against one from a known good build to
+// prove that changes to the renderers are output equivalent. If #image_out is not NULL, it receives the rendered frame as
+// a 1024 x 2048 RGBA8 image (see RasterizeDrawData).
+ImU32 RunDrawListValidation(ImGuiTextBuffer* json_out, ImVector<unsigned char>* image_out = NULL);
+// Runs RunDrawListValidation and compares each item's hash against #reference_json, the report of a known good build with
+// the same ImGui version and ImDrawIdx size. Items that differ or are missing are listed in #report. Returns the number of
+// mismatching items, so 0 proves the output is unchanged. If #reference_image (the image of the known good build) is given,
+// the check runs in tolerance mode for changes that alter geometry but should not alter the picture (e.g. decimation):
+// mismatching items are only listed, and the check fails if more than #max_bad_pixels pixels differ by more than
+// #pixel_tolerance in any channel, in which case the number of such pixels is returned.
+int CheckDrawListValidation(const char* reference_json, ImGuiTextBuffer* report, const unsigned char* reference_image = NULL, int pixel_tolerance = 0, int max_bad_pixels = 0);
 
 }  // namespace ImPlot
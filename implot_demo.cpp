@@ -27,6 +27,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#include <chrono>
 
 #ifdef _MSC_VER
 #define sprintf sprintf_s
@@ -144,15 +145,36 @@ struct HugeTimeData {
     static const int Size = 60*60*24*366;
 };
 
+// plot exported by the Offscreen Rendering example, called inside RenderPlotToPNG's private context
+static void RenderExportPlot(void* user_data) {
+    const int* frequency = (const int*)user_data;
+    static t_float xs[1001], ys1[1001], ys2[1001];
+    for (int i = 0; i < 1001; ++i) {
+        xs[i]  = i * 0.001f;
+        ys1[i] = 0.5f + 0.5f * Sin(2 * 3.14159f * *frequency * xs[i]);
+        ys2[i] = xs[i] * xs[i];
+    }
+    if (ImPlot::BeginPlot("Nightly Report", "x", "f(x)", ImVec2(-1,-1))) {
+        ImPlot::PlotShaded("sin(x)", xs, ys1, 1001);
+        ImPlot::PlotLine("sin(x)", xs, ys1, 1001);
+        ImPlot::PlotLine("x^2", xs, ys2, 1001);
+        ImPlot::EndPlot();
+    }
+}
+
 void ShowDemoWindow(bool* p_open) {
     t_float DEMO_TIME = (t_float)ImGui::GetTime();
     static bool show_imgui_metrics       = false;
     static bool show_imgui_style_editor  = false;
     static bool show_implot_style_editor = false;
     static bool show_implot_benchmark    = false;
+    static bool show_implot_metrics      = false;
     if (show_imgui_metrics) {
         ImGui::ShowMetricsWindow(&show_imgui_metrics);
     }
+    if (show_implot_metrics) {
+        ImPlot::ShowMetricsWindow(&show_implot_metrics);
+    }
     if (show_imgui_style_editor) {
         ImGui::Begin("Style Editor (ImGui)", &show_imgui_style_editor);
         ImGui::ShowStyleEditor();
@@ -177,6 +199,7 @@ void ShowDemoWindow(bool* p_open) {
     if (ImGui::BeginMenuBar()) {
         if (ImGui::BeginMenu("Tools")) {
             ImGui::MenuItem("Metrics (ImGui)",       NULL, &show_imgui_metrics);
+            ImGui::MenuItem("Metrics (ImPlot)",      NULL, &show_implot_metrics);
             ImGui::MenuItem("Style Editor (ImGui)",  NULL, &show_imgui_style_editor);
             ImGui::MenuItem("Style Editor (ImPlot)", NULL, &show_implot_style_editor);
             ImGui::MenuItem("Benchmark",             NULL, &show_implot_benchmark);
@@ -243,6 +266,7 @@ void ShowDemoWindow(bool* p_open) {
         ImGui::Indent(ImGui::CalcItemWidth() - ImGui::GetFrameHeight());
         ImGui::Checkbox("Anti-Aliased Lines", &ImPlot::GetStyle().AntiAliasedLines);
         ImGui::Unindent(indent);
+        ImGui::Combo("Line Join", &ImPlot::GetStyle().LineJoin, "None\0Miter\0Bevel\0");
     }
     //-------------------------------------------------------------------------
     if (ImGui::CollapsingHeader("Line Plots")) {
@@ -348,6 +372,60 @@ void ShowDemoWindow(bool* p_open) {
         }
     }
     //-------------------------------------------------------------------------
+    if (ImGui::CollapsingHeader("Scatter Density")) {
+        static ImVector<t_float> xs, ys;
+        if (xs.empty()) {
+            srand(0);
+            xs.resize(1000000);
+            ys.resize(1000000);
+            for (int i = 0; i < xs.Size; ++i) {
+                // sum of uniforms approximates a normal distribution
+                t_float u = RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f);
+                t_float v = RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f);
+                xs[i] = u;
+                ys[i] = 0.5f * u + v;
+            }
+        }
+        static float bin_size = 4;
+        static bool  hexagonal = true;
+        static bool  partial = false;
+        ImGui::BulletText("1,000,000 points are binned at the current zoom and colored by count.");
+        ImGui::BulletText("Hover a sample to show it in a tooltip (see FindNearestPoint).");
+        ImGui::BulletText("Partial Counts bins four ranges into separate grids, as worker threads would (see CountScatterDensityRange).");
+        ImGui::SliderFloat("Bin Size", &bin_size, 1, 20, "%.0f px");
+        ImGui::SameLine(); ImGui::Checkbox("Hexagonal", &hexagonal);
+        ImGui::SameLine(); ImGui::Checkbox("Partial Counts", &partial);
+        ImPlot::PushColormap(ImPlotColormap_Viridis);
+        if (ImPlot::BeginPlot("##ScatterDensity")) {
+            if (partial) {
+                static ImVector<int> counts, part;
+                const int bins = ImPlot::GetScatterDensityBins(bin_size, hexagonal);
+                counts.resize(0);
+                counts.resize(bins, 0);
+                for (int w = 0; w < 4; ++w) {
+                    part.resize(0);
+                    part.resize(bins, 0);
+                    ImPlot::CountScatterDensityRange(xs.Data, ys.Data, xs.Size * w / 4, xs.Size * (w + 1) / 4, part.Data, bin_size, hexagonal);
+                    ImPlot::MergeBinCounts(counts.Data, part.Data, bins);
+                }
+                ImPlot::PlotScatterDensityCounts("Samples", counts.Data, bin_size, hexagonal);
+            }
+            else {
+                ImPlot::PlotScatterDensity("Samples", xs.Data, ys.Data, xs.Size, bin_size, hexagonal);
+            }
+            // the first hover builds a spatial index of the samples, later queries only visit the cells near the mouse
+            ImPlotPoint pt;
+            const int idx = ImPlot::FindNearestPoint("Samples", xs.Data, ys.Data, xs.Size, 8, &pt);
+            if (idx >= 0) {
+                ImGui::BeginTooltip();
+                ImGui::Text("Sample %d: (%.3f, %.3f)", idx, pt.x, pt.y);
+                ImGui::EndTooltip();
+            }
+            ImPlot::EndPlot();
+        }
+        ImPlot::PopColormap();
+    }
+    //-------------------------------------------------------------------------
     if (ImGui::CollapsingHeader("Bar Plots")) {
         static const char*  labels[]    = {"S1","S2","S3","S4","S5","S6","S7","S8","S9","S10"};
         static const double positions[] = {0,1,2,3,4,5,6,7,8,9};
@@ -382,6 +460,67 @@ void ShowDemoWindow(bool* p_open) {
         }
     }
     //-------------------------------------------------------------------------
+    if (ImGui::CollapsingHeader("Histograms")) {
+        static ImVector<t_float> samples;
+        if (samples.empty()) {
+            srand(0);
+            samples.resize(100000);
+            for (int i = 0; i < samples.Size; ++i) {
+                // sum of uniforms approximates a normal distribution, with a smaller second mode
+                t_float u = RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f);
+                samples[i] = i % 4 == 0 ? 0.5f * u + 3 : u;
+            }
+        }
+        static const char* rules[] = {"Sturges","Scott","Freedman-Diaconis","Fixed"};
+        static int  rule       = 0;
+        static int  bins       = 50;
+        static bool cumulative = false;
+        static bool density    = false;
+        ImGui::BulletText("100,000 samples are binned once and cached until the input or settings change.");
+        ImGui::SetNextItemWidth(200);
+        ImGui::Combo("Bins", &rule, rules, 4);
+        if (rule == 3) {
+            ImGui::SameLine(); ImGui::SetNextItemWidth(200);
+            ImGui::SliderInt("##Count", &bins, 1, 200);
+        }
+        ImGui::SameLine(); ImGui::Checkbox("Cumulative", &cumulative);
+        ImGui::SameLine(); ImGui::Checkbox("Density", &density);
+        const ImPlotHistogramFlags flags = (cumulative ? ImPlotHistogramFlags_Cumulative : 0) | (density ? ImPlotHistogramFlags_Density : 0);
+        // the tallest bin of the previous frame keeps the y-axis fitted as the settings change
+        static double max_height = 1;
+        ImPlot::SetNextPlotLimits(-4, 5, 0, 1.1 * max_height, ImGuiCond_Always);
+        if (ImPlot::BeginPlot("##Histograms")) {
+            ImPlot::SetNextFillStyle(IMPLOT_AUTO_COL, 0.5f);
+            max_height = ImPlot::PlotHistogram("Samples", samples.Data, samples.Size, rule == 3 ? bins : -1 - rule, flags);
+            ImPlot::EndPlot();
+        }
+        static ImVector<t_float> xs2, ys2;
+        if (xs2.empty()) {
+            srand(1);
+            xs2.resize(500000);
+            ys2.resize(500000);
+            for (int i = 0; i < xs2.Size; ++i) {
+                t_float u = RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f);
+                t_float w = RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f) + RandomRange(-1.0f, 1.0f);
+                xs2[i] = u;
+                ys2[i] = u * u + 0.5f * w;
+            }
+        }
+        static int  bins2   = 50;
+        static bool visible = false;
+        ImGui::BulletText("500,000 xs/ys samples are binned into a grid and drawn as a heatmap.");
+        ImGui::BulletText("Visible Range Only rebins just the samples inside the axes limits as they are panned or zoomed.");
+        ImGui::SetNextItemWidth(200);
+        ImGui::SliderInt("Bins 2D", &bins2, 1, 200);
+        ImGui::SameLine(); ImGui::Checkbox("Visible Range Only", &visible);
+        ImPlot::PushColormap(ImPlotColormap_Hot);
+        if (ImPlot::BeginPlot("##Histogram2D", NULL, NULL, ImVec2(-1,0), ImPlotFlags_NoLegend)) {
+            ImPlot::PlotHistogram2D("Samples 2D", xs2.Data, ys2.Data, xs2.Size, bins2, bins2, visible ? ImPlotHistogramFlags_Visible : 0);
+            ImPlot::EndPlot();
+        }
+        ImPlot::PopColormap();
+    }
+    //-------------------------------------------------------------------------
     if (ImGui::CollapsingHeader("Error Bars")) {
         static t_float xs[5]    = {1,2,3,4,5};
         static t_float bar[5]   = {1,2,5,3,4};
@@ -651,6 +790,36 @@ void ShowDemoWindow(bool* p_open) {
         }
     }
     //-------------------------------------------------------------------------
+    if (ImGui::CollapsingHeader("Candlestick Charts")) {
+        static ImVector<double> times, opens, closes, lows, highs;
+        if (times.empty()) {
+            // one candle per minute over two years, as a random walk
+            const int n = 2 * 365 * 24 * 60;
+            times.resize(n); opens.resize(n); closes.resize(n); lows.resize(n); highs.resize(n);
+            srand(0);
+            double price = 100;
+            for (int i = 0; i < n; ++i) {
+                times[i]  = 1546300800 + i * 60.0;
+                opens[i]  = price;
+                price    += RandomRange(-0.05f, 0.05f);
+                closes[i] = price;
+                lows[i]   = (opens[i] < closes[i] ? opens[i] : closes[i]) - RandomRange(0, 0.02f);
+                highs[i]  = (opens[i] > closes[i] ? opens[i] : closes[i]) + RandomRange(0, 0.02f);
+            }
+        }
+        ImGui::BulletText("1,051,200 one minute candles are aggregated into coarser time buckets as you zoom out.");
+        ImPlot::GetStyle().UseLocalTime = false;
+        static bool fit = true;
+        if (fit) {
+            ImPlot::FitNextPlotAxes();
+            fit = false;
+        }
+        if (ImPlot::BeginPlot("##Candlestick",NULL,NULL,ImVec2(-1,0),0,ImPlotAxisFlags_Time)) {
+            ImPlot::PlotCandlestick("Price", times.Data, opens.Data, closes.Data, lows.Data, highs.Data, times.Size);
+            ImPlot::EndPlot();
+        }
+    }
+    //-------------------------------------------------------------------------
     if (ImGui::CollapsingHeader("Multiple Y-Axes")) {
         static t_float xs[1001], xs2[1001], ys1[1001], ys2[1001], ys3[1001];
         for (int i = 0; i < 1001; ++i) {
@@ -697,21 +866,64 @@ void ShowDemoWindow(bool* p_open) {
         static double xmin = 0, xmax = 1, ymin = 0, ymax = 1;
         static bool linkx = true, linky = true;
         t_float data[2] = {0,1};
+        static bool groups = false;
         ImGui::Checkbox("Link X", &linkx);
         ImGui::SameLine();
         ImGui::Checkbox("Link Y", &linky);
-        ImPlot::LinkNextPlotLimits(linkx ? &xmin : NULL , linkx ? &xmax : NULL, linky ? &ymin : NULL, linky ? &ymax : NULL);
+        ImGui::SameLine();
+        ImGui::Checkbox("Use Link Groups", &groups);
+        if (groups)
+            ImGui::BulletText("X group generation: %d, Y group generation: %d", ImPlot::GetLinkGroupGeneration("demo_x"), ImPlot::GetLinkGroupGeneration("demo_y"));
+        if (groups)
+            ImPlot::LinkNextPlotAxes(linkx ? "demo_x" : NULL, linky ? "demo_y" : NULL);
+        else
+            ImPlot::LinkNextPlotLimits(linkx ? &xmin : NULL , linkx ? &xmax : NULL, linky ? &ymin : NULL, linky ? &ymax : NULL);
         if (ImPlot::BeginPlot("Plot A")) {
             ImPlot::PlotLine("Line",data,2);
             ImPlot::EndPlot();
         }
-        ImPlot::LinkNextPlotLimits(linkx ? &xmin : NULL , linkx ? &xmax : NULL, linky ? &ymin : NULL, linky ? &ymax : NULL);
+        if (groups)
+            ImPlot::LinkNextPlotAxes(linkx ? "demo_x" : NULL, linky ? "demo_y" : NULL);
+        else
+            ImPlot::LinkNextPlotLimits(linkx ? &xmin : NULL , linkx ? &xmax : NULL, linky ? &ymin : NULL, linky ? &ymax : NULL);
         if (ImPlot::BeginPlot("Plot B")) {
             ImPlot::PlotLine("Line",data,2);
             ImPlot::EndPlot();
         }
     }
     //-------------------------------------------------------------------------
+    if (ImGui::CollapsingHeader("Subplots")) {
+        static int rows = 3, cols = 3;
+        static ImPlotSubplotFlags flags = ImPlotSubplotFlags_LinkRows | ImPlotSubplotFlags_LinkCols;
+        static t_float data[100];
+        static bool init = true;
+        if (init) {
+            for (int i = 0; i < 100; ++i)
+                data[i] = RandomRange(0.0f, 1.0f);
+            init = false;
+        }
+        ImGui::SliderInt("Rows", &rows, 1, 10);
+        ImGui::SliderInt("Cols", &cols, 1, 10);
+        ImGui::CheckboxFlags("LinkRows", (unsigned int*)&flags, ImPlotSubplotFlags_LinkRows); ImGui::SameLine();
+        ImGui::CheckboxFlags("LinkCols", (unsigned int*)&flags, ImPlotSubplotFlags_LinkCols); ImGui::SameLine();
+        ImGui::CheckboxFlags("LinkAllX", (unsigned int*)&flags, ImPlotSubplotFlags_LinkAllX); ImGui::SameLine();
+        ImGui::CheckboxFlags("LinkAllY", (unsigned int*)&flags, ImPlotSubplotFlags_LinkAllY); ImGui::SameLine();
+        ImGui::CheckboxFlags("NoAlign", (unsigned int*)&flags, ImPlotSubplotFlags_NoAlign);
+        ImGui::BulletText("Every cell shares one child window, and linked rows/columns generate their ticks once.");
+        if (ImPlot::BeginSubplots("My Subplots", rows, cols, ImVec2(-1,500), flags)) {
+            for (int i = 0; i < rows * cols; ++i) {
+                char label[16];
+                sprintf(label, "##Cell%d", i);
+                ImPlot::SetNextPlotLimits(0, 100, 0, 1);
+                if (ImPlot::BeginPlot(label, NULL, NULL, ImVec2(), ImPlotFlags_NoLegend | ImPlotFlags_NoMousePos)) {
+                    ImPlot::PlotLine("data", data, 100, i);
+                    ImPlot::EndPlot();
+                }
+            }
+            ImPlot::EndSubplots();
+        }
+    }
+    //-------------------------------------------------------------------------
     if (ImGui::CollapsingHeader("Querying")) {
         static ImVector<t_float2> data;
         static ImPlotLimits range, query;
@@ -732,19 +944,9 @@ void ShowDemoWindow(bool* p_open) {
             if (data.size() > 0)
                 ImPlot::PlotScatter("Points", &data[0].x, &data[0].y, data.size(), 0, 2 * sizeof(t_float));
             if (ImPlot::IsPlotQueried() && data.size() > 0) {
-                ImPlotLimits range2 = ImPlot::GetPlotQuery();
-                int cnt = 0;
-                t_float2 avg;
-                for (int i = 0; i < data.size(); ++i) {
-                    if (range2.Contains(data[i].x, data[i].y)) {
-                        avg.x += data[i].x;
-                        avg.y += data[i].y;
-                        cnt++;
-                    }
-                }
-                if (cnt > 0) {
-                    avg.x = avg.x / cnt;
-                    avg.y = avg.y / cnt;
+                ImPlotQuerySummary sel = ImPlot::QueryPoints(ImPlot::GetPlotQuery(), &data[0].x, &data[0].y, data.size(), NULL, false, 0, 2 * sizeof(t_float));
+                if (sel.Count > 0) {
+                    t_float2 avg((t_float)sel.Mean.x, (t_float)sel.Mean.y);
                     ImPlot::SetNextMarkerStyle(ImPlotMarker_Square);
                     ImPlot::PlotScatter("Average", &avg.x, &avg.y, 1);
                 }
@@ -986,6 +1188,35 @@ void ShowDemoWindow(bool* p_open) {
             }
             ImGui::EndDragDropTarget();
         }
+        // slowly changing channels are encoded once, so rendering only visits their visible transitions
+        static ImPlotDigitalChannel channels[4];
+        if (channels[0].Times.empty()) {
+            ImVector<t_float> xs, ys;
+            xs.resize(1000000);
+            ys.resize(1000000);
+            srand(0);
+            for (int c = 0; c < 4; ++c) {
+                t_float state = 0;
+                for (int i = 0; i < xs.Size; ++i) {
+                    if (RandomRange(0.0f, 1.0f) < 0.0005f * (c + 1))
+                        state = state > 0 ? 0.0f : 1.0f;
+                    xs[i] = i * 0.001f;
+                    ys[i] = state;
+                }
+                channels[c].Build(xs.Data, ys.Data, xs.Size);
+            }
+        }
+        ImGui::BulletText("Four channels of 1,000,000 dense samples each, run-length encoded into %d transitions.",
+                          channels[0].Times.Size + channels[1].Times.Size + channels[2].Times.Size + channels[3].Times.Size);
+        ImPlot::SetNextPlotLimits(0, 1000, 0, 1);
+        if (ImPlot::BeginPlot("##DigitalChannels", NULL, NULL, ImVec2(-1,200), ImPlotFlags_NoLegend)) {
+            for (int c = 0; c < 4; ++c) {
+                char label[32];
+                sprintf(label, "channel_%d", c);
+                ImPlot::PlotDigital(label, channels[c]);
+            }
+            ImPlot::EndPlot();
+        }
     }
     if (ImGui::CollapsingHeader("Tables")) {
 #ifdef IMGUI_HAS_TABLE
@@ -1020,6 +1251,45 @@ void ShowDemoWindow(bool* p_open) {
             ImPlot::PopColormap();
             ImGui::EndTable();
         }
+        ImGui::BulletText("For thousands of rows, collect the cell rects and render every sparkline at once with PlotSparklines.");
+        static float metrics[1000][100];
+        static bool init = true;
+        if (init) {
+            for (int row = 0; row < 1000; ++row)
+                for (int i = 0; i < 100; ++i)
+                    metrics[row][i] = RandomRange(0.0f, 10.0f);
+            init = false;
+        }
+        static ImVector<ImPlotSparkline> sparks;
+        sparks.shrink(0);
+        if (ImGui::BeginTable("##batched", 2, flags | ImGuiTableFlags_ScrollY, ImVec2(-1,300))) {
+            ImGui::TableSetupColumn("Metric", ImGuiTableColumnFlags_WidthFixed, 75.0f);
+            ImGui::TableSetupColumn("History");
+            ImGui::TableAutoHeaders();
+            ImGuiListClipper clipper;
+            clipper.Begin(1000);
+            while (clipper.Step()) {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                    ImGui::TableNextRow();
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Text("Metric %d", row);
+                    ImGui::TableSetColumnIndex(1);
+                    ImGui::Dummy(ImVec2(ImGui::GetContentRegionAvail().x, ImGui::GetTextLineHeight()));
+                    ImPlotSparkline spark;
+                    spark.Values  = metrics[row];
+                    spark.Count   = 100;
+                    spark.Offset  = offset;
+                    spark.YMin    = 0;
+                    spark.YMax    = 11;
+                    spark.CellMin = ImGui::GetItemRectMin();
+                    spark.CellMax = ImGui::GetItemRectMax();
+                    sparks.push_back(spark);
+                }
+            }
+            // the table's scrolling child window is still current, so its draw list and clip rect are used
+            ImPlot::PlotSparklines(sparks.Data, sparks.Size);
+            ImGui::EndTable();
+        }
 #else
     ImGui::BulletText("You need to merge the ImGui 'tables' branch for this section.");
 #endif
@@ -1138,6 +1408,27 @@ void ShowDemoWindow(bool* p_open) {
         }
     }
     //-------------------------------------------------------------------------
+    if (ImGui::CollapsingHeader("Offscreen Rendering")) {
+        ImGui::BulletText("RenderPlotToPNG renders plots in a private context with the CPU rasterizer and writes a PNG.");
+        ImGui::BulletText("No GPU or renderer backend is needed, so batch reports can be generated on headless servers.");
+        static int frequency = 4;
+        static int size[2] = {800, 450};
+        static ImGuiTextBuffer status;
+        ImGui::SliderInt("Frequency", &frequency, 1, 10);
+        ImGui::InputInt2("Size", size);
+        for (int i = 0; i < 2; ++i)
+            size[i] = size[i] < 16 ? 16 : size[i] > 4096 ? 4096 : size[i];
+        if (ImGui::Button("Export implot_export.png")) {
+            std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+            const bool ok = ImPlot::RenderPlotToPNG("implot_export.png", size[0], size[1], RenderExportPlot, &frequency);
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - t0).count();
+            status.clear();
+            status.appendf(ok ? "Wrote implot_export.png in %.1f ms" : "Failed to write implot_export.png", ms);
+        }
+        ImGui::SameLine();
+        ImGui::TextUnformatted(status.c_str());
+    }
+    //-------------------------------------------------------------------------
     if (ImGui::CollapsingHeader("Custom Context Menus")) {
         ImGui::BulletText("You can implement legend context menus to inject per-item controls and widgets.");
         ImGui::BulletText("Right click the legend label/icon to edit custom item attributes.");
@@ -1245,7 +1536,7 @@ ImPlotPoint Spiral(void*, int idx) {
 void Sparkline(const char* id, const float* values, int count, float min_v, float max_v, int offset, const ImVec4& col, const ImVec2& size) {
     ImPlot::PushStyleVar(ImPlotStyleVar_PlotPadding, ImVec2(0,0));
     ImPlot::SetNextPlotLimits(0, count - 1, min_v, max_v, ImGuiCond_Always);
-    if (ImPlot::BeginPlot(id,0,0,size,ImPlotFlags_CanvasOnly|ImPlotFlags_NoChild,ImPlotAxisFlags_NoDecorations,ImPlotAxisFlags_NoDecorations)) {
+    if (ImPlot::BeginPlot(id,0,0,size,ImPlotFlags_Sparkline,ImPlotAxisFlags_NoDecorations,ImPlotAxisFlags_NoDecorations)) {
         ImPlot::PushStyleColor(ImPlotCol_Line, col);
         ImPlot::PlotLine(id, values, count, offset);
         ImPlot::PushStyleVar(ImPlotStyleVar_FillAlpha, 0.25f);
@@ -1491,4 +1782,473 @@ void ShowBenchmarkTool() {
     }
 }
 
+
+//-----------------------------------------------------------------------------
+// Headless Benchmark
+//-----------------------------------------------------------------------------
+
+enum BenchmarkScenario {
+    BenchmarkScenario_Line,
+    BenchmarkScenario_Scatter,
+    BenchmarkScenario_Shaded,
+    BenchmarkScenario_Bars,
+    BenchmarkScenario_Heatmap,
+    BenchmarkScenario_Digital,
+    BenchmarkScenario_TimeAxis,
+    BenchmarkScenario_LogAxis,
+    BenchmarkScenario_COUNT
+};
+
+static const char* BenchmarkScenarioNames[] = { "line", "scatter", "shaded", "bars", "heatmap", "digital", "time_axis", "log_axis" };
+
+// Private ImGui/ImPlot contexts with a default font atlas and no renderer backend, restoring the previous ones on destruction
+struct HeadlessContext {
+    HeadlessContext(const ImVec2& display_size = ImVec2(1920, 1080)) {
+        PrevImGui  = ImGui::GetCurrentContext();
+        PrevImPlot = ImPlot::GetCurrentContext();
+        ImGuiCtx   = ImGui::CreateContext();
+        ImGui::SetCurrentContext(ImGuiCtx);
+        ImPlotCtx  = ImPlot::CreateContext();
+        ImPlot::SetCurrentContext(ImPlotCtx);
+        ImGuiIO& io    = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = display_size;
+        io.DeltaTime   = 1.0f / 60.0f;
+        // allow RenderPrimitives to start new draw commands with a vertex offset when 16-bit indices run out
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+        unsigned char* tex_pixels;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsAlpha8(&tex_pixels, &tex_w, &tex_h);
+    }
+    ~HeadlessContext() {
+        ImPlot::DestroyContext(ImPlotCtx);
+        ImGui::DestroyContext(ImGuiCtx);
+        ImGui::SetCurrentContext(PrevImGui);
+        ImPlot::SetCurrentContext(PrevImPlot);
+    }
+    // Starts a frame with a single undecorated window covering the display
+    void BeginFrame() {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0,0));
+        ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+        ImGui::Begin("##Headless", NULL, ImGuiWindowFlags_NoDecoration);
+    }
+    void EndFrame() {
+        ImGui::End();
+        ImGui::Render();
+    }
+    ImGuiContext*  PrevImGui;
+    ImPlotContext* PrevImPlot;
+    ImGuiContext*  ImGuiCtx;
+    ImPlotContext* ImPlotCtx;
+};
+
+struct BenchmarkData {
+    ImVector<double> Xs, Ys, Ts, Bits;
+    BenchmarkData(int n) {
+        Xs.resize(n); Ys.resize(n); Ts.resize(n); Bits.resize(n);
+        for (int i = 0; i < n; ++i) {
+            Xs[i]   = i + 1; // start at 1 so the same data works on log axes
+            Ys[i]   = 0.5 + 0.4 * sin(i * 0.01) + RandomRange(-0.05f, 0.05f);
+            Ts[i]   = 1577836800 + i * 60.0; // 01/01/2020, one sample per minute
+            Bits[i] = (i / 7) % 2;
+        }
+    }
+};
+
+static void RenderBenchmarkScenario(int scenario, int items, int points, const BenchmarkData& data) {
+    const double* xs = scenario == BenchmarkScenario_TimeAxis ? data.Ts.Data : data.Xs.Data;
+    const ImPlotAxisFlags x_flags = scenario == BenchmarkScenario_TimeAxis ? ImPlotAxisFlags_Time
+                                  : scenario == BenchmarkScenario_LogAxis  ? ImPlotAxisFlags_LogScale
+                                  : ImPlotAxisFlags_None;
+    if (scenario == BenchmarkScenario_Heatmap)
+        ImPlot::SetNextPlotLimits(0, 1, 0, 1, ImGuiCond_Always);
+    else
+        ImPlot::SetNextPlotLimits(xs[0], xs[points-1], 0, 1, ImGuiCond_Always);
+    if (ImPlot::BeginPlot("##Bench", NULL, NULL, ImVec2(-1,-1), ImPlotFlags_NoChild, x_flags)) {
+        const int side = (int)sqrt((double)points);
+        for (int i = 0; i < items; ++i) {
+            ImGui::PushID(i);
+            switch (scenario) {
+                case BenchmarkScenario_Line:     ImPlot::PlotLine("##item", xs, data.Ys.Data, points); break;
+                case BenchmarkScenario_Scatter:  ImPlot::PlotScatter("##item", xs, data.Ys.Data, points); break;
+                case BenchmarkScenario_Shaded:   ImPlot::PlotShaded("##item", xs, data.Ys.Data, points, 0.0); break;
+                case BenchmarkScenario_Bars:     ImPlot::PlotBars("##item", xs, data.Ys.Data, points, 0.5); break;
+                case BenchmarkScenario_Heatmap:  ImPlot::PlotHeatmap("##item", data.Ys.Data, side, side, 0.0, 1.0, NULL); break;
+                case BenchmarkScenario_Digital:  ImPlot::PlotDigital("##item", xs, data.Bits.Data, points); break;
+                case BenchmarkScenario_TimeAxis: ImPlot::PlotLine("##item", xs, data.Ys.Data, points); break;
+                case BenchmarkScenario_LogAxis:  ImPlot::PlotLine("##item", xs, data.Ys.Data, points); break;
+            }
+            ImGui::PopID();
+        }
+        ImPlot::EndPlot();
+    }
+}
+
+// Renders #count tiny plots of #points points each on a grid covering the display, so that none of them are clipped
+static void RenderBenchmarkSparklines(int count, int points, ImPlotFlags flags, const BenchmarkData& data) {
+    const ImVec2 cell(48, 24);
+    const int cols = (int)(ImGui::GetIO().DisplaySize.x / cell.x);
+    ImPlot::PushStyleVar(ImPlotStyleVar_PlotPadding, ImVec2(0,0));
+    for (int i = 0; i < count; ++i) {
+        ImGui::SetCursorScreenPos(ImVec2((i % cols) * cell.x, (i / cols) * cell.y));
+        ImGui::PushID(i);
+        ImPlot::SetNextPlotLimits(0, ImMax(points, 1), 0, 1, ImGuiCond_Always);
+        if (ImPlot::BeginPlot("##Spark", NULL, NULL, cell, flags, ImPlotAxisFlags_NoDecorations, ImPlotAxisFlags_NoDecorations)) {
+            if (points > 0)
+                ImPlot::PlotLine("##line", data.Ys.Data, points);
+            ImPlot::EndPlot();
+        }
+        ImGui::PopID();
+    }
+    ImPlot::PopStyleVar();
+}
+
+void RunHeadlessBenchmark(ImGuiTextBuffer* json_out, int frames, int max_points, const int* alloc_count) {
+    IM_ASSERT(json_out != NULL && frames > 0 && max_points > 0);
+    static const int item_counts[]  = { 1, 10, 100, 500 };
+    static const int point_counts[] = { 1000, 10000, 100000, 1000000, 10000000 };
+
+    HeadlessContext ctx;
+
+    int data_size = 0;
+    for (int p = 0; p < IM_ARRAYSIZE(point_counts); ++p)
+        data_size = point_counts[p] <= max_points ? point_counts[p] : data_size;
+    BenchmarkData data(ImMax(data_size, 1));
+
+    json_out->appendf("{\n  \"implot_version\": \"%s\",\n  \"imgui_version\": \"%s\",\n", IMPLOT_VERSION, IMGUI_VERSION);
+    json_out->appendf("  \"index_bits\": %d,\n  \"frames\": %d,\n  \"results\": [", (int)sizeof(ImDrawIdx) * 8, frames);
+    bool first = true;
+    for (int s = 0; s < BenchmarkScenario_COUNT; ++s) {
+        for (int i = 0; i < IM_ARRAYSIZE(item_counts); ++i) {
+            for (int p = 0; p < IM_ARRAYSIZE(point_counts); ++p) {
+                const int items  = item_counts[i];
+                const int points = point_counts[p];
+                if ((double)items * points > max_points)
+                    continue;
+                double total_ms = 0;
+                int    allocs   = 0;
+                int    vtx      = 0;
+                int    idx      = 0;
+                // the first frame is a warm up which creates plot/item state and grows buffers
+                for (int f = 0; f <= frames; ++f) {
+                    ctx.BeginFrame();
+                    const int allocs_before = alloc_count != NULL ? *alloc_count : 0;
+                    const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+                    RenderBenchmarkScenario(s, items, points, data);
+                    const std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+                    const int allocs_frame = alloc_count != NULL ? *alloc_count - allocs_before : 0;
+                    ctx.EndFrame();
+                    if (f > 0) {
+                        total_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+                        allocs   += allocs_frame;
+                        vtx       = ImGui::GetDrawData()->TotalVtxCount;
+                        idx       = ImGui::GetDrawData()->TotalIdxCount;
+                    }
+                }
+                json_out->appendf("%s\n    { \"scenario\": \"%s\", \"items\": %d, \"points\": %d, \"ms_per_frame\": %.4f, \"ns_per_point\": %.4f, \"vertices\": %d, \"indices\": %d, ",
+                                  first ? "" : ",", BenchmarkScenarioNames[s], items, points, total_ms / frames,
+                                  total_ms * 1000000.0 / ((double)frames * items * points), vtx, idx);
+                if (alloc_count != NULL)
+                    json_out->appendf("\"allocs_per_frame\": %.2f }", (double)allocs / frames);
+                else
+                    json_out->append("\"allocs_per_frame\": null }");
+                first = false;
+            }
+        }
+    }
+    json_out->append("\n  ],\n  \"sparklines\": [");
+
+    // 1000 tiny plots per frame as regular canvas-only plots and in the lightweight ImPlotFlags_Sparkline mode;
+    // with 0 points, "us_per_plot" is the fixed BeginPlot/EndPlot overhead
+    static const int   spark_points[] = { 0, 100 };
+    static const char* spark_modes[]  = { "canvas_only", "sparkline" };
+    const int spark_count = 1000;
+    first = true;
+    for (int m = 0; m < IM_ARRAYSIZE(spark_modes); ++m) {
+        const ImPlotFlags flags = m == 0 ? ImPlotFlags_CanvasOnly | ImPlotFlags_NoChild : ImPlotFlags_Sparkline;
+        for (int p = 0; p < IM_ARRAYSIZE(spark_points); ++p) {
+            const int points = ImMin(spark_points[p], data.Ys.Size);
+            double total_ms = 0;
+            for (int f = 0; f <= frames; ++f) {
+                ctx.BeginFrame();
+                const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+                RenderBenchmarkSparklines(spark_count, points, flags, data);
+                const std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+                ctx.EndFrame();
+                if (f > 0)
+                    total_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            }
+            json_out->appendf("%s\n    { \"mode\": \"%s\", \"plots\": %d, \"points\": %d, \"ms_per_frame\": %.4f, \"us_per_plot\": %.4f }",
+                              first ? "" : ",", spark_modes[m], spark_count, points, total_ms / frames, total_ms * 1000.0 / ((double)frames * spark_count));
+            first = false;
+        }
+    }
+    json_out->append("\n  ],\n  \"micro\": ");
+
+#ifdef IMPLOT_ENABLE_BENCHMARKS
+    // isolated Getter, Transformer and renderer timings, run inside a plot with positive ranges so log transforms are valid
+    ctx.BeginFrame();
+    ImPlot::SetNextPlotLimits(1, ImMax(data_size, 2), 0.1, 1, ImGuiCond_Always);
+    if (ImPlot::BeginPlot("##MicroBench", NULL, NULL, ImVec2(-1,-1), ImPlotFlags_NoChild)) {
+        ImPlot::RunItemMicroBenchmarks(json_out, ImMax(data_size, 2), frames);
+        ImPlot::EndPlot();
+    }
+    ctx.EndFrame();
+#else
+    json_out->append("null");
+#endif
+    json_out->append("\n}\n");
+}
+
+
+//-----------------------------------------------------------------------------
+// Draw List Validation
+//-----------------------------------------------------------------------------
+
+// Hashes the draw list output of a single item. Positions, UVs and clip rects are quantized to 1/256th of a pixel/texel
+// so that hashes are stable across compilers, while still catching any visible change in geometry.
+struct DrawListHasher {
+    DrawListHasher() { Vtx = Idx = Cmd = 0; }
+    void Begin(const ImDrawList& dl) {
+        Vtx  = dl.VtxBuffer.Size;
+        Idx  = dl.IdxBuffer.Size;
+        Cmd  = dl.CmdBuffer.Size;
+        Elem = Cmd > 0 ? dl.CmdBuffer.back().ElemCount : 0;
+    }
+    ImU32 End(const ImDrawList& dl, int* vtx_count, int* idx_count, int* cmd_count) const {
+        ImU32 hash = 0;
+        for (int i = Vtx; i < dl.VtxBuffer.Size; ++i) {
+            const ImDrawVert& v = dl.VtxBuffer[i];
+            const int q[5] = { (int)ImFloor(v.pos.x * 256 + 0.5f), (int)ImFloor(v.pos.y * 256 + 0.5f),
+                               (int)ImFloor(v.uv.x * 256 + 0.5f),  (int)ImFloor(v.uv.y * 256 + 0.5f), (int)v.col };
+            hash = ImHashData(q, sizeof(q), hash);
+        }
+        if (dl.IdxBuffer.Size > Idx)
+            hash = ImHashData(dl.IdxBuffer.Data + Idx, (dl.IdxBuffer.Size - Idx) * sizeof(ImDrawIdx), hash);
+        // the last command existing before the item may have grown, following ones are new
+        for (int i = ImMax(Cmd - 1, 0); i < dl.CmdBuffer.Size; ++i) {
+            const ImDrawCmd& cmd = dl.CmdBuffer[i];
+            const unsigned int c[3] = { i == Cmd - 1 ? cmd.ElemCount - Elem : cmd.ElemCount, cmd.VtxOffset, cmd.IdxOffset };
+            const int q[4] = { (int)ImFloor(cmd.ClipRect.x * 256 + 0.5f), (int)ImFloor(cmd.ClipRect.y * 256 + 0.5f),
+                               (int)ImFloor(cmd.ClipRect.z * 256 + 0.5f), (int)ImFloor(cmd.ClipRect.w * 256 + 0.5f) };
+            hash = ImHashData(q, sizeof(q), hash);
+            hash = ImHashData(c, sizeof(c), hash);
+        }
+        *vtx_count = dl.VtxBuffer.Size - Vtx;
+        *idx_count = dl.IdxBuffer.Size - Idx;
+        *cmd_count = dl.CmdBuffer.Size - Cmd;
+        return hash;
+    }
+    int Vtx, Idx, Cmd;
+    unsigned int Elem;
+};
+
+// Finds the hash recorded for #scenario/#item in a RunDrawListValidation report
+static bool FindReferenceHash(const char* reference, const char* scenario, const char* item, ImU32* hash) {
+    char key[128];
+    ImFormatString(key, IM_ARRAYSIZE(key), "\"scenario\": \"%s\", \"item\": \"%s\",", scenario, item);
+    const char* entry = strstr(reference, key);
+    const char* field = entry != NULL ? strstr(entry, "\"hash\": \"") : NULL;
+    unsigned int value;
+    if (field == NULL || sscanf(field + 9, "%8X", &value) != 1)
+        return false;
+    *hash = value;
+    return true;
+}
+
+// Counts the items recorded in a RunDrawListValidation report
+static int CountReferenceItems(const char* reference) {
+    int count = 0;
+    for (const char* p = strstr(reference, "\"scenario\": "); p != NULL; p = strstr(p + 1, "\"scenario\": "))
+        count++;
+    return count;
+}
+
+// Counts the pixels of two RGBA8 images where any channel differs by more than #tolerance
+static int CountPixelDifferences(const unsigned char* a, const unsigned char* b, int pixel_count, int tolerance) {
+    int count = 0;
+    for (int i = 0; i < pixel_count * 4; i += 4) {
+        for (int c = 0; c < 4; ++c) {
+            const int d = (int)a[i + c] - (int)b[i + c];
+            if (d > tolerance || -d > tolerance) {
+                count++;
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+struct DrawListValidator {
+    DrawListValidator(ImGuiTextBuffer* report) { Report = report; Combined = 0; Record = false; First = true; Reference = NULL; Mismatches = NULL; Checked = Failures = 0; }
+    // Begins hashing an item, call immediately before the PlotX function
+    void BeginItem() { Hasher.Begin(*ImPlot::GetPlotDrawList()); }
+    // Ends hashing an item and records it if this is the recorded frame
+    void EndItem(const char* scenario, const char* item) {
+        int vtx, idx, cmd;
+        const ImU32 hash = Hasher.End(*ImPlot::GetPlotDrawList(), &vtx, &idx, &cmd);
+        if (!Record)
+            return;
+        Combined = ImHashData(&hash, sizeof(hash), Combined);
+        Report->appendf("%s\n    { \"scenario\": \"%s\", \"item\": \"%s\", \"vertices\": %d, \"indices\": %d, \"new_cmds\": %d, \"hash\": \"%08X\" }",
+                        First ? "" : ",", scenario, item, vtx, idx, cmd, hash);
+        First = false;
+        if (Reference == NULL)
+            return;
+        ImU32 expected;
+        if (!FindReferenceHash(Reference, scenario, item, &expected)) {
+            Mismatches->appendf("%s/%s: not in the reference\n", scenario, item);
+            Failures++;
+            return;
+        }
+        Checked++;
+        if (expected != hash) {
+            Mismatches->appendf("%s/%s: hash %08X, expected %08X (%d vertices, %d indices)\n", scenario, item, hash, expected, vtx, idx);
+            Failures++;
+        }
+    }
+    ImGuiTextBuffer* Report;
+    DrawListHasher   Hasher;
+    ImU32            Combined;
+    bool             Record;
+    bool             First;
+    const char*      Reference;  // report of a known good build to compare each item against (or NULL)
+    ImGuiTextBuffer* Mismatches; // receives one line per item that differs from the reference
+    int              Checked;    // items found in the reference
+    int              Failures;   // items that differ from or are missing in the reference
+};
+
+#define VALIDATE_ITEM(validator, scenario, item, call) do { validator.BeginItem(); call; validator.EndItem(scenario, item); } while (0)
+
+static void RenderValidationScenarios(DrawListValidator& v, const BenchmarkData& data) {
+    const int     n  = 1000;
+    const double* xs = data.Xs.Data;
+    const double* ys = data.Ys.Data;
+    const ImPlotFlags flags = ImPlotFlags_NoChild | ImPlotFlags_NoMousePos;
+
+    // lines and markers with every data layout and the anti-aliased path
+    ImPlot::SetNextPlotLimits(0, n, 0, 1, ImGuiCond_Always);
+    if (ImPlot::BeginPlot("##Lines", NULL, NULL, ImVec2(800,400), flags)) {
+        VALIDATE_ITEM(v, "lines", "values",       ImPlot::PlotLine("values", ys, n));
+        VALIDATE_ITEM(v, "lines", "xs_ys",        ImPlot::PlotLine("xs_ys", xs, ys, n));
+        VALIDATE_ITEM(v, "lines", "stride",       ImPlot::PlotLine("stride", xs, ys, n / 2, 0, 2 * sizeof(double)));
+        VALIDATE_ITEM(v, "lines", "ring",         ImPlot::PlotLine("ring", xs, ys, n, n / 3));
+        ImPlot::SetNextMarkerStyle(ImPlotMarker_Circle);
+        VALIDATE_ITEM(v, "lines", "markers",      ImPlot::PlotLine("markers", xs, ys, 100));
+        VALIDATE_ITEM(v, "lines", "scatter",      ImPlot::PlotScatter("scatter", xs, ys, n));
+        ImPlot::GetStyle().AntiAliasedLines = true;
+        VALIDATE_ITEM(v, "lines", "anti_aliased", ImPlot::PlotLine("anti_aliased", xs, ys, n));
+        ImPlot::GetStyle().AntiAliasedLines = false;
+        ImPlot::PushStyleVar(ImPlotStyleVar_LineJoin, ImPlotLineJoin_Miter);
+        VALIDATE_ITEM(v, "lines", "miter",        ImPlot::PlotLine("miter", xs, ys, n));
+        ImPlot::PopStyleVar();
+        ImPlot::PushStyleVar(ImPlotStyleVar_LineJoin, ImPlotLineJoin_Bevel);
+        VALIDATE_ITEM(v, "lines", "bevel",        ImPlot::PlotLine("bevel", xs, ys, n));
+        ImPlot::PopStyleVar();
+        ImPlot::EndPlot();
+    }
+    // filled and bar-like items
+    ImPlot::SetNextPlotLimits(0, 50, -0.5, 1.5, ImGuiCond_Always);
+    if (ImPlot::BeginPlot("##Fills", NULL, NULL, ImVec2(800,400), flags)) {
+        VALIDATE_ITEM(v, "fills", "shaded",       ImPlot::PlotShaded("shaded", xs, ys, n, 0.0));
+        VALIDATE_ITEM(v, "fills", "bars",         ImPlot::PlotBars("bars", ys, 50, 0.5));
+        VALIDATE_ITEM(v, "fills", "bars_h",       ImPlot::PlotBarsH("bars_h", ys, 50, 0.5));
+        VALIDATE_ITEM(v, "fills", "error_bars",   ImPlot::PlotErrorBars("error_bars", xs, ys, data.Ys.Data + 1, 50));
+        VALIDATE_ITEM(v, "fills", "error_bars_h", ImPlot::PlotErrorBarsH("error_bars_h", xs, ys, data.Ys.Data + 1, 50));
+        VALIDATE_ITEM(v, "fills", "stems",        ImPlot::PlotStems("stems", xs, ys, 50));
+        VALIDATE_ITEM(v, "fills", "digital",      ImPlot::PlotDigital("digital", xs, data.Bits.Data, n));
+        VALIDATE_ITEM(v, "fills", "histogram",    ImPlot::PlotHistogram("histogram", ys, n, 25, 0, ImPlotRange(-0.5, 1.5)));
+        ImPlot::EndPlot();
+    }
+    // heatmap and pie chart (both use text labels)
+    ImPlot::SetNextPlotLimits(0, 1, 0, 1, ImGuiCond_Always);
+    if (ImPlot::BeginPlot("##Maps", NULL, NULL, ImVec2(400,400), flags)) {
+        static const char* labels[] = { "a", "b", "c", "d" };
+        VALIDATE_ITEM(v, "maps", "heatmap",      ImPlot::PlotHeatmap("heatmap", ys, 10, 10, 0.0, 1.0));
+        VALIDATE_ITEM(v, "maps", "pie_chart",    ImPlot::PlotPieChart(labels, ys, 4, 0.5, 0.5, 0.4, true));
+        VALIDATE_ITEM(v, "maps", "text",         ImPlot::PlotText("text", 0.5, 0.5));
+        VALIDATE_ITEM(v, "maps", "density",      ImPlot::PlotScatterDensity("density", data.Bits.Data, ys, n, 8));
+        VALIDATE_ITEM(v, "maps", "density_hex",  ImPlot::PlotScatterDensity("density_hex", data.Bits.Data, ys, n, 8, true));
+        VALIDATE_ITEM(v, "maps", "histogram_2d", ImPlot::PlotHistogram2D("histogram_2d", xs, ys, n, 20, 20));
+        ImPlot::EndPlot();
+    }
+    // log axes
+    ImPlot::SetNextPlotLimits(1, n, 0.01, 1, ImGuiCond_Always);
+    if (ImPlot::BeginPlot("##Log", NULL, NULL, ImVec2(800,400), flags, ImPlotAxisFlags_LogScale, ImPlotAxisFlags_LogScale)) {
+        VALIDATE_ITEM(v, "log", "line", ImPlot::PlotLine("line", xs, ys, n));
+        ImPlot::EndPlot();
+    }
+    // more than 65535 vertices in a single item, which crosses the 16-bit ImDrawIdx limit in RenderPrimitives
+    ImPlot::SetNextPlotLimits(0, data.Xs.Size, 0, 1, ImGuiCond_Always);
+    if (ImPlot::BeginPlot("##Wrap", NULL, NULL, ImVec2(800,400), flags)) {
+        VALIDATE_ITEM(v, "wrap", "line",   ImPlot::PlotLine("line", xs, ys, data.Xs.Size));
+        VALIDATE_ITEM(v, "wrap", "shaded", ImPlot::PlotShaded("shaded", xs, ys, data.Xs.Size, 0.0));
+        ImPlot::EndPlot();
+    }
+}
+
+#undef VALIDATE_ITEM
+
+// Size of the display the validation scenarios are laid out on (and of the image RunDrawListValidation rasterizes)
+#define VALIDATION_WIDTH  1024
+#define VALIDATION_HEIGHT 2048
+
+static ImU32 RunDrawListValidationEx(ImGuiTextBuffer* json_out, ImVector<unsigned char>* image_out, DrawListValidator& validator) {
+    HeadlessContext ctx(ImVec2(VALIDATION_WIDTH, VALIDATION_HEIGHT));
+    ImPlot::GetStyle().AntiAliasedLines = false;
+
+    // deterministic data (BenchmarkData adds noise from rand()), 40000 points is 160000 line vertices
+    BenchmarkData data(40000);
+    for (int i = 0; i < data.Ys.Size; ++i)
+        data.Ys[i] = 0.5 + 0.4 * sin(i * 0.01) + 0.05 * sin(i * 0.37);
+
+    json_out->appendf("{\n  \"implot_version\": \"%s\",\n  \"imgui_version\": \"%s\",\n", IMPLOT_VERSION, IMGUI_VERSION);
+    json_out->appendf("  \"index_bits\": %d,\n  \"items\": [", (int)sizeof(ImDrawIdx) * 8);
+    // the first frame creates plot and item state, the second is recorded
+    for (int f = 0; f < 2; ++f) {
+        validator.Record = f == 1;
+        ctx.BeginFrame();
+        RenderValidationScenarios(validator, data);
+        ctx.EndFrame();
+    }
+    json_out->appendf("\n  ],\n  \"hash\": \"%08X\"\n}\n", validator.Combined);
+    if (image_out != NULL) {
+        image_out->resize(VALIDATION_WIDTH * VALIDATION_HEIGHT * 4);
+        memset(image_out->Data, 0, (size_t)image_out->Size);
+        ImPlot::RasterizeDrawData(ImGui::GetDrawData(), image_out->Data, VALIDATION_WIDTH, VALIDATION_HEIGHT);
+    }
+    return validator.Combined;
+}
+
+ImU32 RunDrawListValidation(ImGuiTextBuffer* json_out, ImVector<unsigned char>* image_out) {
+    IM_ASSERT(json_out != NULL);
+    DrawListValidator validator(json_out);
+    return RunDrawListValidationEx(json_out, image_out, validator);
+}
+
+int CheckDrawListValidation(const char* reference_json, ImGuiTextBuffer* report, const unsigned char* reference_image, int pixel_tolerance, int max_bad_pixels) {
+    IM_ASSERT(reference_json != NULL && report != NULL);
+    ImGuiTextBuffer json;
+    ImVector<unsigned char> image;
+    DrawListValidator validator(&json);
+    validator.Reference  = reference_json;
+    validator.Mismatches = report;
+    RunDrawListValidationEx(&json, reference_image != NULL ? &image : NULL, validator);
+    const int missing = CountReferenceItems(reference_json) - validator.Checked;
+    if (missing > 0) {
+        report->appendf("%d reference items were not rendered\n", missing);
+        validator.Failures += missing;
+    }
+    if (reference_image == NULL)
+        return validator.Failures;
+    // tolerance mode: differing items are only reported, the rendered images decide
+    const int bad = CountPixelDifferences(image.Data, reference_image, VALIDATION_WIDTH * VALIDATION_HEIGHT, pixel_tolerance);
+    report->appendf("%d pixels differ by more than %d (at most %d allowed)\n", bad, pixel_tolerance, max_bad_pixels);
+    return bad > max_bad_pixels ? bad : 0;
+}
+
+#undef VALIDATION_WIDTH
+#undef VALIDATION_HEIGHT
+
 }
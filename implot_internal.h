@@ -52,6 +52,8 @@ struct ImPlotAxisState;
 struct ImPlotAxisColor;
 struct ImPlotItem;
 struct ImPlotState;
+struct ImPlotLinkGroup;
+struct ImPlotSubplot;
 struct ImPlotNextPlotData;
 
 //-----------------------------------------------------------------------------
@@ -81,6 +83,36 @@ extern ImPlotContext* GImPlot; // Current implicit context pointer
 #define IMPLOT_MIN_TIME 0
 // Maximum allowable timestamp value 01/01/3000 @ 12:00am (UTC)
 #define IMPLOT_MAX_TIME 32503680000
+// Number of measured strings retained by the per-context text size cache
+#define IMPLOT_TEXT_CACHE_SIZE 512
+// Size in bytes of each block of the per-context frame arena
+#define IMPLOT_ARENA_BLOCK_SIZE 65536
+// Number of frames of history recorded for each plot by the metrics instrumentation
+#define IMPLOT_METRICS_HISTORY 120
+// Maximum length of a line join miter, as a multiple of half the line weight (longer miters are clamped)
+#define IMPLOT_MITER_LIMIT 4.0f
+// Width in pixels of the transparent fringe added to each side of anti-aliased lines
+#define IMPLOT_AA_FRINGE 1.0f
+// Width and height in pixels of the independent tiles processed by the software rasterizer
+#define IMPLOT_RASTER_TILE_SIZE 64
+
+// Profiling hooks. Define IMPLOT_ENABLE_PROFILER (e.g. in imconfig.h) to forward hot path scopes to the callbacks set
+// with SetProfilerCallbacks, or define IMPLOT_PROFILE_BEGIN(name) and IMPLOT_PROFILE_END(name) to call a profiler
+// directly. Otherwise all hooks compile to nothing.
+#if defined(IMPLOT_ENABLE_PROFILER) && !defined(IMPLOT_PROFILE_BEGIN)
+#define IMPLOT_PROFILE_BEGIN(name) ImPlot::ProfileBegin(name)
+#define IMPLOT_PROFILE_END(name)   ImPlot::ProfileEnd(name)
+#endif
+#ifdef IMPLOT_PROFILE_BEGIN
+#define IMPLOT_PROFILE_ENABLED
+#define IMPLOT_PROFILE_CONCAT_(A, B) A##B
+#define IMPLOT_PROFILE_CONCAT(A, B)  IMPLOT_PROFILE_CONCAT_(A, B)
+#define IMPLOT_PROFILE_SCOPE(name)   ImPlot::ImPlotProfileScope IMPLOT_PROFILE_CONCAT(implot_profile_scope_, __LINE__)(name)
+#else
+#define IMPLOT_PROFILE_BEGIN(name) ((void)0)
+#define IMPLOT_PROFILE_END(name)   ((void)0)
+#define IMPLOT_PROFILE_SCOPE(name) ((void)0)
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] Generic Helpers
@@ -286,6 +318,46 @@ struct ImPlotTickCollection {
 
 };
 
+// Generated ticks for one axis retained across frames, reused while the key (range, pixel size, flags, font) is unchanged
+struct ImPlotTickCache {
+    ImPlotTickCollection Ticks;
+    ImPlotRange          Range;
+    float                PixelSize;
+    ImPlotAxisFlags      Flags;
+    ImFont*              Font;
+    float                FontSize;
+    bool                 LocalTime;
+    bool                 Valid;
+
+    ImPlotTickCache() {
+        Ticks.Reset();
+        Range     = ImPlotRange(0,0);
+        PixelSize = FontSize = 0;
+        Flags     = ImPlotAxisFlags_None;
+        Font      = NULL;
+        LocalTime = false;
+        Valid     = false;
+    }
+
+    bool Matches(const ImPlotRange& range, float pixel_size, ImPlotAxisFlags flags, bool local_time) const {
+        return Valid && Range.Min == range.Min && Range.Max == range.Max && PixelSize == pixel_size && Flags == flags
+            && Font == ImGui::GetFont() && FontSize == ImGui::GetFontSize() && LocalTime == local_time;
+    }
+
+    void Store(const ImPlotTickCollection& ticks, const ImPlotRange& range, float pixel_size, ImPlotAxisFlags flags, bool local_time) {
+        Ticks     = ticks;
+        Range     = range;
+        PixelSize = pixel_size;
+        Flags     = flags;
+        Font      = ImGui::GetFont();
+        FontSize  = ImGui::GetFontSize();
+        LocalTime = local_time;
+        Valid     = true;
+    }
+
+    void Invalidate() { Valid = false; }
+};
+
 // Axis state information that must persist after EndPlot
 struct ImPlotAxis
 {
@@ -297,6 +369,7 @@ struct ImPlotAxis
     bool            HoveredTot;
     double*         LinkedMin;
     double*         LinkedMax;
+    int             LinkGroup; // index into ImPlotContext::LinkGroups, or -1
 
     ImPlotAxis() {
         Flags      = PreviousFlags = ImPlotAxisFlags_None;
@@ -306,6 +379,7 @@ struct ImPlotAxis
         HoveredExt = false;
         HoveredTot = false;
         LinkedMin  = LinkedMax = NULL;
+        LinkGroup  = -1;
     }
 
     bool SetMin(double _min) {
@@ -394,15 +468,153 @@ struct ImPlotAxisColor
     ImPlotAxisColor() { Major = Minor = MajTxt = MinTxt = 0; }
 };
 
+// Cost of rendering a plot or item during one frame
+struct ImPlotMetrics
+{
+    float TimeMs;    // CPU time spent between Begin/End
+    int   Points;    // points/primitives handed to the renderers
+    int   Culled;    // points/primitives rejected by the cull rect
+    int   Vertices;  // vertices emitted to the draw list
+    int   Indices;   // indices emitted to the draw list
+    int   CmdSplits; // draw commands added (e.g. by 16-bit index wraparound)
+
+    ImPlotMetrics() { Clear(); }
+    void Clear() { TimeMs = 0; Points = Culled = Vertices = Indices = CmdSplits = 0; }
+};
+
+// Draw list and clock snapshot taken when a plot or item begins, resolved into ImPlotMetrics when it ends
+struct ImPlotMetricsCapture
+{
+    double StartMs;
+    int    StartVtx;
+    int    StartIdx;
+    int    StartCmd;
+    bool   Active;   // false if metrics were disabled when the capture began
+
+    ImPlotMetricsCapture() { StartMs = 0; StartVtx = StartIdx = StartCmd = 0; Active = false; }
+};
+
+// Binned results of a histogram item, reused across frames while its input is unchanged
+struct ImPlotHistogramCache
+{
+    const void*          Data;     // identity of the binned values
+    const double*        EdgesIn;  // identity of user supplied edges (NULL if binned by count/rule)
+    int                  Count;
+    int                  Stride;
+    int                  Bins;     // requested bin count or ImPlotBin_ rule
+    ImPlotHistogramFlags Flags;
+    ImPlotRange          Range;    // requested range (NAN if auto)
+    ImVector<double>     Edges;    // computed bin edges (Heights.Size + 1)
+    ImVector<double>     Heights;  // computed bin heights
+    double               MaxHeight;
+    bool                 Valid;
+
+    ImPlotHistogramCache() { Data = NULL; EdgesIn = NULL; Count = Stride = Bins = Flags = 0; MaxHeight = 0; Valid = false; }
+
+    bool Matches(const void* data, const double* edges, int count, int stride, int bins, ImPlotHistogramFlags flags, const ImPlotRange& range) const {
+        // NAN ranges never compare equal, so compare their bit patterns
+        return Valid && Data == data && EdgesIn == edges && Count == count && Stride == stride && Bins == bins && Flags == flags &&
+               memcmp(&Range, &range, sizeof(ImPlotRange)) == 0;
+    }
+};
+
+// Binned results of a 2D histogram item, reused across frames while its input is unchanged
+struct ImPlotHistogram2DCache
+{
+    const void*          DataX;    // identity of the binned xs
+    const void*          DataY;    // identity of the binned ys
+    int                  Count;
+    int                  Stride;
+    int                  XBins;    // requested bin counts or ImPlotBin_ rules
+    int                  YBins;
+    ImPlotHistogramFlags Flags;
+    ImPlotLimits         Range;    // requested range (NAN if auto), or the visible range if ImPlotHistogramFlags_Visible
+    ImPlotLimits         Bounds;   // computed bounds of the grid
+    ImPlotLimits         Extents;  // min/max of the data, used for fitting when only the visible range is binned
+    int                  Rows;     // computed grid size
+    int                  Cols;
+    ImVector<double>     Values;   // computed bin heights in row-major order (first row at the top)
+    double               MaxHeight;
+    bool                 Valid;
+
+    ImPlotHistogram2DCache() { DataX = DataY = NULL; Count = Stride = XBins = YBins = Flags = Rows = Cols = 0; MaxHeight = 0; Valid = false; }
+
+    bool Matches(const void* xs, const void* ys, int count, int stride, int x_bins, int y_bins, ImPlotHistogramFlags flags, const ImPlotLimits& range) const {
+        return Valid && DataX == xs && DataY == ys && Count == count && Stride == stride && XBins == x_bins && YBins == y_bins && Flags == flags &&
+               memcmp(&Range, &range, sizeof(ImPlotLimits)) == 0;
+    }
+};
+
+// Spatial index of an item's points for nearest point queries, kept until the indexed data changes or BustHitIndex is called
+struct ImPlotHitIndex
+{
+    const void*   DataX;     // identity of the indexed xs
+    const void*   DataY;     // identity of the indexed ys
+    int           Count;
+    int           Offset;
+    int           Stride;
+    bool          Valid;
+    bool          Sorted;    // xs are ascending, so queries binary search them and the grid is not built
+    ImPlotLimits  Bounds;    // extents of the grid in plot coordinates
+    int           Rows;
+    int           Cols;
+    ImVector<int> CellStart; // first entry of each cell in Indices (Rows*Cols+1 entries)
+    ImVector<int> Indices;   // point indices ordered by cell
+
+    ImPlotHitIndex() { DataX = DataY = NULL; Count = Offset = Stride = Rows = Cols = 0; Valid = Sorted = false; }
+
+    bool Matches(const void* xs, const void* ys, int count, int offset, int stride) const {
+        return Valid && DataX == xs && DataY == ys && Count == count && Offset == offset && Stride == stride;
+    }
+};
+
+// An OHLC candle
+struct ImPlotCandle
+{
+    double X, Open, Close, Low, High;
+    double HalfWidth; // half the width of the candle's time slot
+};
+
+// Candles of an OHLC item aggregated into time buckets, kept until the data, its first time, its last candle
+// or the bucket size changes, or BustCandleCache is called
+struct ImPlotCandleCache
+{
+    const double*          Xs;     // identity of the aggregated data
+    const double*          Opens;
+    const double*          Closes;
+    const double*          Lows;
+    const double*          Highs;
+    int                    Count;
+    double                 FirstX; // samples at the ends, to notice feeds updated in place
+    ImPlotCandle           Last;
+    ImPlotTimeUnit         Unit;   // bucket size
+    int                    Step;
+    ImVector<ImPlotCandle> Candles;
+    bool                   Valid;
+
+    ImPlotCandleCache() { Xs = Opens = Closes = Lows = Highs = NULL; Count = Unit = Step = 0; FirstX = 0; Valid = false; }
+
+    bool Matches(const double* xs, const double* opens, const double* closes, const double* lows, const double* highs, int count, ImPlotTimeUnit unit, int step) const {
+        if (!(Valid && Xs == xs && Opens == opens && Closes == closes && Lows == lows && Highs == highs && Count == count && Unit == unit && Step == step))
+            return false;
+        const int i = count - 1;
+        return FirstX == xs[0] && Last.X == xs[i] && Last.Open == opens[i] && Last.Close == closes[i] && Last.Low == lows[i] && Last.High == highs[i];
+    }
+};
+
 // State information for Plot items
 struct ImPlotItem
 {
-    ImGuiID      ID;
-    ImVec4       Color;
-    int          NameOffset;
-    bool         Show;
-    bool         LegendHovered;
-    bool         SeenThisFrame;
+    ImGuiID       ID;
+    ImVec4        Color;
+    int           NameOffset;
+    bool          Show;
+    bool          LegendHovered;
+    bool          SeenThisFrame;
+    int           LastFrameSeen;
+    double        LastTimeSeen;
+    ImPlotMetrics Metrics;
+    char          DebugName[32];
 
     ImPlotItem() {
         ID            = 0;
@@ -411,6 +623,9 @@ struct ImPlotItem
         Show          = true;
         SeenThisFrame = false;
         LegendHovered = false;
+        LastFrameSeen = 0;
+        LastTimeSeen  = 0;
+        DebugName[0]  = 0;
     }
 
     ~ImPlotItem() { ID = 0; }
@@ -424,23 +639,125 @@ struct ImPlotState
     ImPlotAxis         XAxis;
     ImPlotAxis         YAxis[IMPLOT_Y_AXES];
     ImPool<ImPlotItem> Items;
+    // type specific item caches, keyed by item ID and added on first use
+    ImPool<ImPlotHistogramCache> HistogramCaches;
+    ImPool<ImPlotHistogram2DCache> Histogram2DCaches;
+    ImPool<ImPlotHitIndex> HitIndices;
+    ImPool<ImPlotCandleCache> CandleCaches;
+    ImPlotTickCache    XTickCache;
+    ImPlotTickCache    YTickCache[IMPLOT_Y_AXES];
     ImVec2             SelectStart;
     ImVec2             QueryStart;
     ImRect             QueryRect;
     ImRect             BB_Legend;
+    ImGuiID            LegendLayoutKey;
+    float              LegendLabelWidth;
+    int                LegendScroll;
     bool               Selecting;
     bool               Querying;
     bool               Queried;
     bool               DraggingQuery;
     int                ColormapIdx;
     int                CurrentYAxis;
+    int                LastFrameSeen;
+    double             LastTimeSeen;
+    ImPlotMetrics      Metrics;
+    float              TimeHistory[IMPLOT_METRICS_HISTORY];
+    float              VtxHistory[IMPLOT_METRICS_HISTORY];
+    int                HistoryOffset;
+    char               DebugName[32];
 
     ImPlotState() {
         Flags        = PreviousFlags = ImPlotFlags_None;
         SelectStart  = QueryStart = ImVec2(0,0);
         Selecting    = Querying = Queried = DraggingQuery = false;
         ColormapIdx  = CurrentYAxis = 0;
+        LastFrameSeen    = 0;
+        LastTimeSeen     = 0;
+        HistoryOffset    = 0;
+        DebugName[0]     = 0;
+        for (int i = 0; i < IMPLOT_METRICS_HISTORY; ++i)
+            TimeHistory[i] = VtxHistory[i] = 0;
+        LegendLayoutKey  = 0;
+        LegendLabelWidth = 0;
+        LegendScroll     = 0;
+    }
+};
+
+// Axis limits shared by every axis linked to the same group (see LinkNextPlotAxes)
+struct ImPlotLinkGroup
+{
+    ImPlotRange Range;      // shared limits (NAN until the first linked axis seeds them)
+    int         Generation; // incremented each time Range actually changes
+    int         LastFrameSeen;
+    double      LastTimeSeen;
+
+    ImPlotLinkGroup() { Generation = LastFrameSeen = 0; LastTimeSeen = 0; }
+};
+
+// Holds subplot grid state information that must persist after EndSubplots
+struct ImPlotSubplot
+{
+    ImGuiID                   ID;
+    ImPlotSubplotFlags        Flags;
+    int                       Rows;
+    int                       Cols;
+    int                       CurrentIdx;
+    ImRect                    FrameRect;
+    ImRect                    GridRect;
+    ImVector<ImPlotTickCache> RowTickCache; // y-axis ticks shared by linked cells
+    ImVector<ImPlotTickCache> ColTickCache; // x-axis ticks shared by linked cells
+    ImVector<float>           RowPads;      // top/bottom gutters per row from the previous frame
+    ImVector<float>           ColPads;      // left/right gutters per column from the previous frame
+    ImVector<float>           NextRowPads;  // top/bottom gutters per row accumulated this frame
+    ImVector<float>           NextColPads;  // left/right gutters per column accumulated this frame
+    bool                      ChildWindowMade;
+    int                       LastFrameSeen;
+    double                    LastTimeSeen;
+
+    ImPlotSubplot() {
+        ID              = 0;
+        Flags           = ImPlotSubplotFlags_None;
+        Rows = Cols     = CurrentIdx = 0;
+        ChildWindowMade = false;
+        LastFrameSeen   = 0;
+        LastTimeSeen    = 0;
+    }
+
+    ~ImPlotSubplot() { ClearTickCaches(); }
+
+    // ImVector does not construct/destruct its elements, so the tick caches are managed by hand
+    void ResizeTickCaches(int rows, int cols) {
+        ClearTickCaches();
+        RowTickCache.resize(rows);
+        ColTickCache.resize(cols);
+        for (int i = 0; i < rows; ++i)
+            IM_PLACEMENT_NEW(&RowTickCache[i]) ImPlotTickCache();
+        for (int i = 0; i < cols; ++i)
+            IM_PLACEMENT_NEW(&ColTickCache[i]) ImPlotTickCache();
     }
+
+    void ClearTickCaches() {
+        for (int i = 0; i < RowTickCache.Size; ++i)
+            RowTickCache[i].~ImPlotTickCache();
+        for (int i = 0; i < ColTickCache.Size; ++i)
+            ColTickCache[i].~ImPlotTickCache();
+        RowTickCache.clear();
+        ColTickCache.clear();
+    }
+
+    // link group of the y-axes of a row (or of all cells for ImPlotSubplotFlags_LinkAllY)
+    ImGuiID GetRowLinkID(int row) const {
+        const int idx = ImHasFlag(Flags, ImPlotSubplotFlags_LinkAllY) ? -1 : row;
+        return ImHashData(&idx, sizeof(idx), ImHashStr("##SubplotRow", 0, ID));
+    }
+    // link group of the x-axes of a column (or of all cells for ImPlotSubplotFlags_LinkAllX)
+    ImGuiID GetColLinkID(int col) const {
+        const int idx = ImHasFlag(Flags, ImPlotSubplotFlags_LinkAllX) ? -1 : col;
+        return ImHashData(&idx, sizeof(idx), ImHashStr("##SubplotCol", 0, ID));
+    }
+    bool LinksY() const { return ImHasFlag(Flags, ImPlotSubplotFlags_LinkRows) || ImHasFlag(Flags, ImPlotSubplotFlags_LinkAllY); }
+    bool LinksX() const { return ImHasFlag(Flags, ImPlotSubplotFlags_LinkCols) || ImHasFlag(Flags, ImPlotSubplotFlags_LinkAllX); }
 };
 
 // Temporary data storage for upcoming plot
@@ -460,42 +777,172 @@ struct ImPlotNextPlotData
     double*     LinkedXmax;
     double*     LinkedYmin[IMPLOT_Y_AXES];
     double*     LinkedYmax[IMPLOT_Y_AXES];
+    ImGuiID     LinkGroupX;
+    ImGuiID     LinkGroupY[IMPLOT_Y_AXES];
 
     ImPlotNextPlotData() {
         HasXRange         = false;
         ShowDefaultTicksX = true;
         FitX              = false;
         LinkedXmin = LinkedXmax = NULL;
+        LinkGroupX = 0;
         for (int i = 0; i < IMPLOT_Y_AXES; ++i) {
             HasYRange[i]         = false;
             ShowDefaultTicksY[i] = true;
             FitY[i]              = false;
             LinkedYmin[i] = LinkedYmax[i] = NULL;
+            LinkGroupY[i] = 0;
         }
     }
 };
 
 // Temporary data storage for upcoming item
 struct ImPlotItemStyle {
-    ImVec4       Colors[5]; // ImPlotCol_Line, ImPlotCol_Fill, ImPlotCol_MarkerOutline, ImPlotCol_MarkerFill, ImPlotCol_ErrorBar
-    float        LineWeight;
-    ImPlotMarker Marker;
-    float        MarkerSize;
-    float        MarkerWeight;
-    float        FillAlpha;
-    float        ErrorBarSize;
-    float        ErrorBarWeight;
-    float        DigitalBitHeight;
-    float        DigitalBitGap;
-    bool         RenderLine;
-    bool         RenderFill;
-    bool         RenderMarkerLine;
-    bool         RenderMarkerFill;
+    ImVec4         Colors[5]; // ImPlotCol_Line, ImPlotCol_Fill, ImPlotCol_MarkerOutline, ImPlotCol_MarkerFill, ImPlotCol_ErrorBar
+    float          LineWeight;
+    ImPlotLineJoin LineJoin;
+    ImPlotMarker   Marker;
+    float          MarkerSize;
+    float          MarkerWeight;
+    float          FillAlpha;
+    float          ErrorBarSize;
+    float          ErrorBarWeight;
+    float          DigitalBitHeight;
+    float          DigitalBitGap;
+    bool           RenderLine;
+    bool           RenderFill;
+    bool           RenderMarkerLine;
+    bool           RenderMarkerFill;
     ImPlotItemStyle() {
         for (int i = 0; i < 5; ++i)
             Colors[i] = IMPLOT_AUTO_COL;
         LineWeight = MarkerSize = MarkerWeight = FillAlpha = ErrorBarSize = ErrorBarWeight = DigitalBitHeight = DigitalBitGap = IMPLOT_AUTO;
-        Marker = IMPLOT_AUTO;
+        Marker = LineJoin = IMPLOT_AUTO;
+    }
+};
+
+// Least recently used cache of text sizes keyed by (string hash, font, font size)
+struct ImPlotTextSizeCache
+{
+    struct Entry {
+        ImGuiID Key;
+        ImVec2  Size;
+        int     Prev, Next;
+    };
+
+    ImVector<Entry> Entries;
+    ImGuiStorage    Map;      // Key -> index into Entries
+    int             Head;     // most recently used entry
+    int             Tail;     // least recently used entry
+    int             Capacity;
+    int             Hits;
+    int             Misses;
+
+    ImPlotTextSizeCache() {
+        Capacity = IMPLOT_TEXT_CACHE_SIZE;
+        Clear();
+    }
+
+    void Clear() {
+        Entries.shrink(0);
+        Map.Clear();
+        Head = Tail = -1;
+        Hits = Misses = 0;
+    }
+
+    float HitRate() const { return (Hits + Misses) > 0 ? (float)Hits / (float)(Hits + Misses) : 0.0f; }
+
+    void Unlink(int idx) {
+        Entry& e = Entries[idx];
+        if (e.Prev != -1) Entries[e.Prev].Next = e.Next; else Head = e.Next;
+        if (e.Next != -1) Entries[e.Next].Prev = e.Prev; else Tail = e.Prev;
+        e.Prev = e.Next = -1;
+    }
+
+    void PushFront(int idx) {
+        Entry& e = Entries[idx];
+        e.Prev = -1;
+        e.Next = Head;
+        if (Head != -1) Entries[Head].Prev = idx;
+        Head = idx;
+        if (Tail == -1) Tail = idx;
+    }
+};
+
+// Bump allocator for transient per-plot scratch data. Memory is only valid until the arena is reset at the end of
+// EndPlot. Blocks are retained across resets, so steady state plotting performs no heap allocations.
+struct ImPlotFrameArena
+{
+    struct Block {
+        char* Data;
+        int   Size;
+    };
+
+    ImVector<Block> Blocks;
+    int             Current;    // block currently being bumped
+    int             Offset;     // bytes used in current block
+    int             Used;       // bytes handed out since last reset
+    int             HighWater;  // maximum of Used over all resets
+    int             HeapAllocs; // number of blocks ever allocated
+
+    ImPlotFrameArena() { Current = Offset = Used = HighWater = HeapAllocs = 0; }
+
+    ~ImPlotFrameArena() {
+        for (int i = 0; i < Blocks.Size; ++i)
+            IM_FREE(Blocks[i].Data);
+    }
+
+    void* Alloc(int size, int align = 16) {
+        for (; Current < Blocks.Size; ++Current, Offset = 0) {
+            const int start = (Offset + align - 1) & ~(align - 1);
+            if (start + size <= Blocks[Current].Size) {
+                Offset = start + size;
+                Used  += size;
+                HighWater = ImMax(HighWater, Used);
+                return Blocks[Current].Data + start;
+            }
+        }
+        Block block;
+        block.Size = ImMax(IMPLOT_ARENA_BLOCK_SIZE, size);
+        block.Data = (char*)IM_ALLOC((size_t)block.Size);
+        Blocks.push_back(block);
+        HeapAllocs++;
+        Current   = Blocks.Size - 1;
+        Offset    = size;
+        Used     += size;
+        HighWater = ImMax(HighWater, Used);
+        return block.Data;
+    }
+
+    void Reset() { Current = Offset = Used = 0; }
+};
+
+// Age based eviction settings and counters for plot and item state
+struct ImPlotGcState
+{
+    int    MaxAgeFrames;   // evict after this many frames unseen (<= 0 to ignore)
+    double MaxAgeSeconds;  // evict after this many seconds unseen (<= 0 to ignore)
+    int    LastFrame;      // last ImGui frame plots were collected
+    int    PlotsLive;
+    int    PlotsEvicted;   // total since context creation
+    int    ItemsLive;      // summed over plots submitted this frame
+    int    ItemsEvicted;   // total since context creation
+
+    ImPlotGcState() {
+        MaxAgeFrames  = 0;
+        MaxAgeSeconds = 0;
+        LastFrame     = -1;
+        PlotsLive     = PlotsEvicted = 0;
+        ItemsLive     = ItemsEvicted = 0;
+    }
+
+    bool Enabled() const { return MaxAgeFrames > 0 || MaxAgeSeconds > 0; }
+
+    bool Expired(int last_frame, double last_time) const {
+        // something submitted last frame is never garbage, regardless of frame time
+        return Enabled() && ImGui::GetFrameCount() - last_frame > 1
+            && (MaxAgeFrames  <= 0 || ImGui::GetFrameCount() - last_frame > MaxAgeFrames)
+            && (MaxAgeSeconds <= 0 || ImGui::GetTime() - last_time > MaxAgeSeconds);
     }
 };
 
@@ -506,6 +953,13 @@ struct ImPlotContext {
     ImPlotState*        CurrentPlot;
     ImPlotItem*         CurrentItem;
 
+    // Subplot States
+    ImPool<ImPlotSubplot> Subplots;
+    ImPlotSubplot*        CurrentSubplot;
+
+    // Axis Link Groups
+    ImPool<ImPlotLinkGroup> LinkGroups;
+
     // Legend
     ImVector<int>   LegendIndices;
     ImGuiTextBuffer LegendLabels;
@@ -564,6 +1018,21 @@ struct ImPlotContext {
     // Time
     tm Tm;
 
+    // Text Measurement
+    ImPlotTextSizeCache TextSizeCache;
+
+    // Garbage Collection
+    ImPlotGcState Gc;
+
+    // Transient Scratch Memory
+    ImPlotFrameArena FrameArena;
+
+    // Metrics
+    ImPlotMetricsCapture PlotCapture;
+    ImPlotMetricsCapture ItemCapture;
+    int                  MetricsFrame;   // last frame ShowMetricsWindow was visible, captures only run while it is
+    bool                 MetricsShowVtx; // ShowMetricsWindow plots vertex counts instead of CPU time
+
     // Misc
     int                VisibleItemCount;
     int                DigitalPlotItemCnt;
@@ -627,6 +1096,18 @@ void Initialize(ImPlotContext* ctx);
 // Resets an ImPlot context for the next call to BeginPlot
 void Reset(ImPlotContext* ctx);
 
+// Invokes the begin/end callbacks set with SetProfilerCallbacks, if any
+void ProfileBegin(const char* name);
+void ProfileEnd(const char* name);
+#ifdef IMPLOT_PROFILE_ENABLED
+// Calls IMPLOT_PROFILE_BEGIN/IMPLOT_PROFILE_END for the lifetime of a scope (see IMPLOT_PROFILE_SCOPE)
+struct ImPlotProfileScope {
+    ImPlotProfileScope(const char* name) : Name(name) { IMPLOT_PROFILE_BEGIN(Name); }
+    ~ImPlotProfileScope() { IMPLOT_PROFILE_END(Name); }
+    const char* Name;
+};
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Utils
 //-----------------------------------------------------------------------------
@@ -637,6 +1118,12 @@ ImPlotState* GetPlot(const char* title);
 ImPlotState* GetCurrentPlot();
 // Busts the cache for every plot in the current context
 void BustPlotCache();
+// Frees plots, subplot grids and link groups (other than the current ones) that have outlived the garbage collection age. Runs once per ImGui frame.
+void CollectPlotGarbage();
+// Frees items of a plot that were not submitted this frame and have outlived the garbage collection age, and resets SeenThisFrame for the rest
+void CollectItemGarbage(ImPlotState& plot);
+// Removes keys of freed entries from an ImPool's map so it does not grow with every unique ID ever seen
+void CompactPoolMap(ImGuiStorage& map);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Item Utils
@@ -657,6 +1144,18 @@ ImPlotItem* GetItem(const char* label_id);
 ImPlotItem* GetItem(const char* plot_title, const char* item_label_id);
 // Gets the current item
 ImPlotItem* GetCurrentItem();
+// Adds points processed and culled by a renderer to the current item's metrics
+inline void AddItemMetrics(int points, int culled) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.CurrentItem) {
+        gp.CurrentItem->Metrics.Points += points;
+        gp.CurrentItem->Metrics.Culled += culled;
+    }
+    if (gp.CurrentPlot) {
+        gp.CurrentPlot->Metrics.Points += points;
+        gp.CurrentPlot->Metrics.Culled += culled;
+    }
+}
 // Busts the cache for every item for every plot in the current context.
 void BustItemCache();
 
@@ -687,6 +1186,12 @@ inline bool RangesOverlap(const ImPlotRange& r1, const ImPlotRange& r2)
 void PushLinkedAxis(ImPlotAxis& axis);
 // Updates axis internal range from points for linked axes.
 void PullLinkedAxis(ImPlotAxis& axis);
+// Marks the axis link group as seen this frame so that it is not garbage collected.
+void TouchLinkGroup(ImPlotAxis& axis);
+// Updates the axis link group from the axis range, bumping its generation if the range changed.
+void PushLinkGroup(ImPlotAxis& axis);
+// Updates the axis range from its link group (or seeds the group if it has no range yet).
+void PullLinkGroup(ImPlotAxis& axis);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Legend Utils
@@ -696,6 +1201,8 @@ void PullLinkedAxis(ImPlotAxis& axis);
 int GetLegendCount();
 // Gets the ith entry string for the current legend
 const char* GetLegendLabel(int i);
+// Returns the widest label width of the current legend, re-measured only when its entries, labels or font change
+float GetLegendLabelWidth();
 
 //-----------------------------------------------------------------------------
 // [SECTION] Tick Utils
@@ -744,8 +1251,14 @@ void ResampleColormap(const ImVec4* colormap_in, int size_in, ImVec4* colormap_o
 
 // Draws vertical text. The position is the bottom left of the text rect.
 void AddTextVertical(ImDrawList *DrawList, ImVec2 pos, ImU32 col, const char* text_begin, const char* text_end = NULL);
+// Calculates the size of text like ImGui::CalcTextSize, reusing sizes measured with the same font and font size
+ImVec2 CalcTextSizeCached(const char* text, const char* text_end = NULL, bool hide_text_after_double_hash = false);
 // Calculates the size of vertical text
-inline ImVec2 CalcTextSizeVertical(const char *text) { ImVec2 sz = ImGui::CalcTextSize(text); return ImVec2(sz.y, sz.x); }
+inline ImVec2 CalcTextSizeVertical(const char *text) { ImVec2 sz = CalcTextSizeCached(text); return ImVec2(sz.y, sz.x); }
+// Returns the fraction of CalcTextSizeCached calls served from the cache since the last bust
+inline float GetTextSizeCacheHitRate() { return GImPlot->TextSizeCache.HitRate(); }
+// Empties the text size cache for the current context (e.g. after rebuilding the font atlas)
+inline void BustTextSizeCache() { GImPlot->TextSizeCache.Clear(); }
 // Returns white or black text given background color
 inline ImU32 CalcTextColor(const ImVec4& bg) { return (bg.x * 0.299 + bg.y * 0.587 + bg.z * 0.114) > 0.729 ? IM_COL32_BLACK : IM_COL32_WHITE; }
 
@@ -753,6 +1266,15 @@ inline ImU32 CalcTextColor(const ImVec4& bg) { return (bg.x * 0.299 + bg.y * 0.5
 // [SECTION] Math and Misc Utils
 //-----------------------------------------------------------------------------
 
+// Returns a monotonic, high resolution timestamp in milliseconds
+double GetPerfTimeMs();
+// Returns true if plot and item metrics are being captured, i.e. ShowMetricsWindow was visible this or the previous frame
+inline bool MetricsEnabled() { return GImPlot->MetricsFrame >= 0 && GImPlot->MetricsFrame >= ImGui::GetFrameCount() - 1; }
+// Snapshots the clock and draw list sizes at the start of a plot or item (does nothing unless MetricsEnabled)
+void BeginMetricsCapture(ImPlotMetricsCapture& capture, const ImDrawList& draw_list);
+// Adds the time and draw list growth since BeginMetricsCapture to #metrics, if the capture is active
+void EndMetricsCapture(const ImPlotMetricsCapture& capture, const ImDrawList& draw_list, ImPlotMetrics& metrics);
+
 // Rounds x to powers of 2,5 and 10 for generating axis labels (from Graphics Gems 1 Chapter 11.2)
 double NiceNum(double x, bool round);
 // Computes order of magnitude of double.
@@ -779,6 +1301,10 @@ void FillRange(ImVector<T>& buffer, int n, T vmin, T vmax) {
     }
 }
 
+// Allocates uninitialized scratch space for #count elements from the frame arena, valid until the end of the current plot
+template <typename T>
+inline T* AllocFrame(int count) { return (T*)GImPlot->FrameArena.Alloc(count * (int)sizeof(T)); }
+
 // Offsets and strides a data buffer
 template <typename T>
 inline T OffsetAndStride(const T* data, int idx, int count, int offset, int stride) {
@@ -826,6 +1352,10 @@ ImPlotTime FloorTime(const ImPlotTime& t, ImPlotTimeUnit unit);
 ImPlotTime CeilTime(const ImPlotTime& t, ImPlotTimeUnit unit);
 // Rounds a timestamp up or down to the nearest unit.
 ImPlotTime RoundTime(const ImPlotTime& t, ImPlotTimeUnit unit);
+// Gets the smallest natural time step (e.g. 1, 5, 15 or 30 minutes) spanning at least #min_span seconds.
+void GetTimeStepForSpan(double min_span, ImPlotTimeUnit* unit, int* step);
+// Rounds a timestamp down to the start of its #step #unit(s) bucket (day and month buckets start at the timestamp's day/month).
+ImPlotTime FloorTimeStep(const ImPlotTime& t, ImPlotTimeUnit unit, int step);
 
 // Get year from timestamp
 int GetYear(const ImPlotTime& t);
@@ -847,4 +1377,19 @@ void PlotRects(const char* label_id, const float* xs, const float* ys, int count
 void PlotRects(const char* label_id, const double* xs, const double* ys, int count, int offset = 0, int stride = sizeof(double));
 void PlotRects(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset = 0);
 
+//-----------------------------------------------------------------------------
+// [SECTION] Internal Benchmarks
+// Only compiled if IMPLOT_ENABLE_BENCHMARKS is defined (e.g. in imconfig.h)
+//-----------------------------------------------------------------------------
+
+#ifdef IMPLOT_ENABLE_BENCHMARKS
+
+// Times every Getter, Transformer and primitive renderer in isolation for contiguous, strided and ring buffer (offset)
+// data of up to #max_points points, keeping the best of #repeats runs, and appends a JSON array of results to #json_out.
+// Must be called between BeginPlot() and EndPlot() with positive axis ranges. Emitted geometry is discarded afterwards,
+// but this should only be used in throwaway (e.g. headless) frames.
+void RunItemMicroBenchmarks(ImGuiTextBuffer* json_out, int max_points = 1000000, int repeats = 5);
+
+#endif // #ifdef IMPLOT_ENABLE_BENCHMARKS
+
 } // namespace ImPlot
\ No newline at end of file
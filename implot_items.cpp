@@ -54,7 +54,12 @@ ImPlotItem* RegisterOrGetItem(const char* label_id) {
     ImPlotItem* item = gp.CurrentPlot->Items.GetOrAddByKey(id);
     if (item->SeenThisFrame)
         return item;
+    if (item->DebugName[0] == 0)
+        ImFormatString(item->DebugName, IM_ARRAYSIZE(item->DebugName), "%s", label_id);
+    item->Metrics.Clear();
     item->SeenThisFrame = true;
+    item->LastFrameSeen = ImGui::GetFrameCount();
+    item->LastTimeSeen  = ImGui::GetTime();
     int idx = gp.CurrentPlot->Items.GetIndex(item);
     item->ID = id;
     if (ImGui::FindRenderedTextEnd(label_id, NULL) != label_id) {
@@ -95,12 +100,26 @@ ImPlotItem* GetCurrentItem() {
     return gp.CurrentItem;
 }
 
+// Returns the entry of the current item in one of the current plot's item cache pools, adding it on first use
+template <typename T>
+static T& GetCurrentItemCache(ImPool<T>& pool) {
+    ImPlotContext& gp = *GImPlot;
+    return *pool.GetOrAddByKey(gp.CurrentItem->ID);
+}
+
 void BustItemCache() {
     ImPlotContext& gp = *GImPlot;
-    for (int p = 0; p < gp.Plots.GetSize(); ++p) {
-        ImPlotState& plot = *gp.Plots.GetByIndex(p);
+    for (int p = 0; p < gp.Plots.Map.Data.Size; ++p) {
+        const int idx = gp.Plots.Map.Data[p].val_i;
+        if (idx == -1) // freed by garbage collection
+            continue;
+        ImPlotState& plot = *gp.Plots.GetByIndex(idx);
         plot.ColormapIdx = 0;
         plot.Items.Clear();
+        plot.HistogramCaches.Clear();
+        plot.Histogram2DCaches.Clear();
+        plot.HitIndices.Clear();
+        plot.CandleCaches.Clear();
     }
 }
 
@@ -117,6 +136,10 @@ bool BeginItem(const char* label_id, ImPlotCol recolor_from) {
     else {
         // set current item
         gp.CurrentItem = item;
+        if (ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_Sparkline))
+            gp.ItemCapture.Active = false;
+        else
+            BeginMetricsCapture(gp.ItemCapture, *GetPlotDrawList());
         ImPlotItemStyle& s = gp.NextItemStyle;
         // override item color
         if (recolor_from != -1) {
@@ -133,6 +156,7 @@ bool BeginItem(const char* label_id, ImPlotCol recolor_from) {
         s.Colors[ImPlotCol_ErrorBar]       = IsColorAuto(s.Colors[ImPlotCol_ErrorBar])      ? ( GetStyleColorVec4(ImPlotCol_ErrorBar)                                                                         ) : s.Colors[ImPlotCol_ErrorBar];
         // stage next item style vars
         s.LineWeight         = s.LineWeight       < 0 ? gp.Style.LineWeight       : s.LineWeight;
+        s.LineJoin           = s.LineJoin         < 0 ? gp.Style.LineJoin         : s.LineJoin;
         s.Marker             = s.Marker           < 0 ? gp.Style.Marker           : s.Marker;
         s.MarkerSize         = s.MarkerSize       < 0 ? gp.Style.MarkerSize       : s.MarkerSize;
         s.MarkerWeight       = s.MarkerWeight     < 0 ? gp.Style.MarkerWeight     : s.MarkerWeight;
@@ -168,6 +192,8 @@ void EndItem() {
     PopPlotClipRect();
     // reset next item data
     gp.NextItemStyle = ImPlotItemStyle();
+    // record item metrics
+    EndMetricsCapture(gp.ItemCapture, *GetPlotDrawList(), gp.CurrentItem->Metrics);
     // set current item
     gp.CurrentItem = NULL;
 }
@@ -492,6 +518,199 @@ struct LineStripRenderer {
     static const int VtxConsumed = 4;
 };
 
+// Adds an anti-aliased line as an opaque core quad flanked by two quads fading to transparent over #fringe pixels
+inline void AddLineAA(const ImVec2& P1, const ImVec2& P2, float half_weight, float fringe, ImU32 col, ImU32 col_trans, ImDrawList& DrawList, ImVec2 uv) {
+    float dx = P2.x - P1.x;
+    float dy = P2.y - P1.y;
+    IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+    const float ix = dy * half_weight,            iy = -dx * half_weight;
+    const float ox = dy * (half_weight + fringe), oy = -dx * (half_weight + fringe);
+    DrawList._VtxWritePtr[0].pos = ImVec2(P1.x + ox, P1.y + oy); DrawList._VtxWritePtr[0].col = col_trans;
+    DrawList._VtxWritePtr[1].pos = ImVec2(P1.x + ix, P1.y + iy); DrawList._VtxWritePtr[1].col = col;
+    DrawList._VtxWritePtr[2].pos = ImVec2(P1.x - ix, P1.y - iy); DrawList._VtxWritePtr[2].col = col;
+    DrawList._VtxWritePtr[3].pos = ImVec2(P1.x - ox, P1.y - oy); DrawList._VtxWritePtr[3].col = col_trans;
+    DrawList._VtxWritePtr[4].pos = ImVec2(P2.x + ox, P2.y + oy); DrawList._VtxWritePtr[4].col = col_trans;
+    DrawList._VtxWritePtr[5].pos = ImVec2(P2.x + ix, P2.y + iy); DrawList._VtxWritePtr[5].col = col;
+    DrawList._VtxWritePtr[6].pos = ImVec2(P2.x - ix, P2.y - iy); DrawList._VtxWritePtr[6].col = col;
+    DrawList._VtxWritePtr[7].pos = ImVec2(P2.x - ox, P2.y - oy); DrawList._VtxWritePtr[7].col = col_trans;
+    for (int i = 0; i < 8; ++i)
+        DrawList._VtxWritePtr[i].uv = uv;
+    DrawList._VtxWritePtr += 8;
+    // three quads (outer fringe, core, outer fringe) between the vertex columns at P1 (0-3) and P2 (4-7)
+    for (int q = 0; q < 3; ++q) {
+        const unsigned int a = DrawList._VtxCurrentIdx + q;
+        DrawList._IdxWritePtr[0] = (ImDrawIdx)(a);
+        DrawList._IdxWritePtr[1] = (ImDrawIdx)(a + 1);
+        DrawList._IdxWritePtr[2] = (ImDrawIdx)(a + 5);
+        DrawList._IdxWritePtr[3] = (ImDrawIdx)(a);
+        DrawList._IdxWritePtr[4] = (ImDrawIdx)(a + 5);
+        DrawList._IdxWritePtr[5] = (ImDrawIdx)(a + 4);
+        DrawList._IdxWritePtr += 6;
+    }
+    DrawList._VtxCurrentIdx += 8;
+}
+
+// Anti-aliased variant of LineStripRenderer, emits feathered quads in bulk instead of going through ImDrawList::AddLine
+template <typename TGetter, typename TTransformer>
+struct LineStripRendererAA {
+    inline LineStripRendererAA(TGetter getter, TTransformer transformer, ImU32 col, float weight) :
+        Getter(getter),
+        Transformer(transformer)
+    {
+        Prims      = Getter.Count - 1;
+        Col        = col;
+        ColTrans   = col & ~IM_COL32_A_MASK;
+        HalfWeight = ImMax(weight - IMPLOT_AA_FRINGE, 0.0f) * 0.5f;
+        P1 = Transformer(Getter(0));
+    }
+    inline bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) {
+        ImVec2 P2 = Transformer(Getter(prim + 1));
+        if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
+            P1 = P2;
+            return false;
+        }
+        AddLineAA(P1,P2,HalfWeight,IMPLOT_AA_FRINGE,Col,ColTrans,DrawList,uv);
+        P1 = P2;
+        return true;
+    }
+    TGetter Getter;
+    TTransformer Transformer;
+    int Prims;
+    ImU32 Col, ColTrans;
+    float HalfWeight;
+    ImVec2 P1;
+    static const int IdxConsumed = 18;
+    static const int VtxConsumed = 8;
+};
+
+// Line strip renderer which shares vertices between consecutive segments and connects them with a miter (clamped to
+// IMPLOT_MITER_LIMIT times the half weight) or a bevel join. Prims are points rather than segments: each one emits the
+// vertices of its joint and the quad back to the previous joint. A point is culled when both of its adjacent segments
+// are outside of the cull rect, and the strip restarts at the next visible point (or at a new draw command).
+template <typename TGetter, typename TTransformer, bool Bevel>
+struct LineStripJoinRenderer {
+    inline LineStripJoinRenderer(TGetter getter, TTransformer transformer, ImU32 col, float weight) :
+        Getter(getter),
+        Transformer(transformer)
+    {
+        Prims      = Getter.Count;
+        Col        = col;
+        HalfWeight = weight * 0.5f;
+        P0 = P1    = Transformer(Getter(0));
+        P2         = Prims > 1 ? Transformer(Getter(1)) : P1;
+        InVisible  = false;
+        LastEnd    = 0;
+        PrevL = PrevR = 0;
+        PrevLPos = PrevRPos = P1;
+    }
+    inline void AddVtx(ImDrawList& DrawList, const ImVec2& pos, const ImVec2& uv) {
+        DrawList._VtxWritePtr->pos = pos;
+        DrawList._VtxWritePtr->uv  = uv;
+        DrawList._VtxWritePtr->col = Col;
+        DrawList._VtxWritePtr++;
+    }
+    inline void AddTri(ImDrawList& DrawList, unsigned int a, unsigned int b, unsigned int c) {
+        DrawList._IdxWritePtr[0] = (ImDrawIdx)a;
+        DrawList._IdxWritePtr[1] = (ImDrawIdx)b;
+        DrawList._IdxWritePtr[2] = (ImDrawIdx)c;
+        DrawList._IdxWritePtr += 3;
+    }
+    inline bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) {
+        // P0 is the previous point, P1 this point and P2 the next point
+        const bool has_next   = prim + 1 < Prims;
+        const bool in_visible = InVisible;
+        InVisible = has_next && cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)));
+        const bool rendered = in_visible || InVisible;
+        if (rendered) {
+            unsigned int v = DrawList._VtxCurrentIdx;
+            bool connect   = in_visible && v == LastEnd;
+            if (in_visible && !connect) {
+                // RenderPrimitives started a new draw command (resetting the vertex index), so re-emit the previous
+                // joint there to keep the incoming segment (RenderPrimitives reserves room for these two vertices)
+                AddVtx(DrawList, PrevLPos, uv);
+                AddVtx(DrawList, PrevRPos, uv);
+                PrevL   = v;
+                PrevR   = v + 1;
+                v      += 2;
+                connect = true;
+            }
+            float d0x = P1.x - P0.x, d0y = P1.y - P0.y;
+            float d1x = P2.x - P1.x, d1y = P2.y - P1.y;
+            IM_NORMALIZE2F_OVER_ZERO(d0x, d0y);
+            IM_NORMALIZE2F_OVER_ZERO(d1x, d1y);
+            if (prim == 0)  { d0x = d1x; d0y = d1y; }
+            if (!has_next)  { d1x = d0x; d1y = d0y; }
+            // normals of the incoming and outgoing segments, and the miter direction between them
+            const ImVec2 n0(d0y, -d0x), n1(d1y, -d1x);
+            float mx = n0.x + n1.x, my = n0.y + n1.y;
+            IM_NORMALIZE2F_OVER_ZERO(mx, my);
+            if (mx == 0 && my == 0) { mx = n0.x; my = n0.y; } // segments fold back on themselves
+            const float  cos_half = mx * n0.x + my * n0.y;
+            const float  len      = HalfWeight / ImMax(cos_half, 1.0f / IMPLOT_MITER_LIMIT);
+            const ImVec2 m(mx * len, my * len);
+            unsigned int in_l, in_r, out_l, out_r;
+            if (!Bevel) {
+                PrevLPos = P1 + m;
+                PrevRPos = P1 - m;
+                AddVtx(DrawList, PrevLPos, uv);
+                AddVtx(DrawList, PrevRPos, uv);
+                in_l = out_l = v;
+                in_r = out_r = v + 1;
+            }
+            else if (d0x * d1y - d0y * d1x > 0) {
+                // left (+normal) side is the outside of the turn
+                PrevLPos = P1 + n1 * HalfWeight;
+                PrevRPos = P1 - m;
+                AddVtx(DrawList, P1 + n0 * HalfWeight, uv);
+                AddVtx(DrawList, PrevRPos, uv);
+                AddVtx(DrawList, PrevLPos, uv);
+                in_l = v; in_r = out_r = v + 1; out_l = v + 2;
+            }
+            else {
+                // right (-normal) side is the outside of the turn
+                PrevLPos = P1 + m;
+                PrevRPos = P1 - n1 * HalfWeight;
+                AddVtx(DrawList, PrevLPos, uv);
+                AddVtx(DrawList, P1 - n0 * HalfWeight, uv);
+                AddVtx(DrawList, PrevRPos, uv);
+                in_l = out_l = v; in_r = v + 1; out_r = v + 2;
+            }
+            // quad back to the previous joint (degenerate when starting a new strip)
+            if (connect) {
+                AddTri(DrawList, PrevL, PrevR, in_r);
+                AddTri(DrawList, PrevL, in_r, in_l);
+            }
+            else {
+                AddTri(DrawList, v, v, v);
+                AddTri(DrawList, v, v, v);
+            }
+            // bevel triangle between the incoming and outgoing outer vertices
+            if (Bevel)
+                AddTri(DrawList, v, v + 1, v + 2);
+            DrawList._VtxCurrentIdx = v + VtxConsumed;
+            LastEnd = DrawList._VtxCurrentIdx;
+            PrevL   = out_l;
+            PrevR   = out_r;
+        }
+        P0 = P1;
+        P1 = P2;
+        if (prim + 2 < Prims)
+            P2 = Transformer(Getter(prim + 2));
+        return rendered;
+    }
+    TGetter Getter;
+    TTransformer Transformer;
+    int Prims;
+    ImU32 Col;
+    float HalfWeight;
+    ImVec2 P0, P1, P2;
+    bool InVisible;
+    unsigned int LastEnd, PrevL, PrevR;
+    ImVec2 PrevLPos, PrevRPos; // outgoing vertices of the previous joint
+    static const int IdxConsumed = Bevel ? 9 : 6;
+    static const int VtxConsumed = Bevel ? 3 : 2;
+};
+
 template <typename TGetter1, typename TGetter2, typename TTransformer>
 struct LineSegmentsRenderer {
     inline LineSegmentsRenderer(TGetter1 getter1, TGetter2 getter2, TTransformer transformer, ImU32 col, float weight) :
@@ -522,6 +741,37 @@ struct LineSegmentsRenderer {
     static const int VtxConsumed = 4;
 };
 
+// Anti-aliased variant of LineSegmentsRenderer
+template <typename TGetter1, typename TGetter2, typename TTransformer>
+struct LineSegmentsRendererAA {
+    inline LineSegmentsRendererAA(TGetter1 getter1, TGetter2 getter2, TTransformer transformer, ImU32 col, float weight) :
+        Getter1(getter1),
+        Getter2(getter2),
+        Transformer(transformer)
+    {
+        Prims      = ImMin(Getter1.Count, Getter2.Count);
+        Col        = col;
+        ColTrans   = col & ~IM_COL32_A_MASK;
+        HalfWeight = ImMax(weight - IMPLOT_AA_FRINGE, 0.0f) * 0.5f;
+    }
+    inline bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) {
+        ImVec2 P1 = Transformer(Getter1(prim));
+        ImVec2 P2 = Transformer(Getter2(prim));
+        if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
+            return false;
+        AddLineAA(P1,P2,HalfWeight,IMPLOT_AA_FRINGE,Col,ColTrans,DrawList,uv);
+        return true;
+    }
+    TGetter1 Getter1;
+    TGetter2 Getter2;
+    TTransformer Transformer;
+    int Prims;
+    ImU32 Col, ColTrans;
+    float HalfWeight;
+    static const int IdxConsumed = 18;
+    static const int VtxConsumed = 8;
+};
+
 template <typename TGetter1, typename TGetter2, typename TTransformer>
 struct ShadedRenderer {
     ShadedRenderer(TGetter1 getter1, TGetter2 getter2, TTransformer transformer, ImU32 col) :
@@ -634,52 +884,62 @@ template <> const unsigned int MaxIdx<unsigned int>::Value   = 4294967295;
 /// Renders primitive shapes in bulk as efficiently as possible.
 template <typename Renderer>
 inline void RenderPrimitives(Renderer renderer, ImDrawList& DrawList, const ImRect& cull_rect) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::RenderPrimitives");
     unsigned int prims        = renderer.Prims;
-    unsigned int prims_culled = 0;
+    unsigned int total_culled = 0;
     unsigned int idx          = 0;
+    // the write pointers are only measured against the buffer ends once this call has reserved space (a draw list reset
+    // for the frame has NULL write pointers while its buffers keep their previous allocation)
+    bool         reserved     = false;
     const ImVec2 uv = DrawList._Data->TexUvWhitePixel;
     while (prims) {
+        // reserved space at the end of the buffers left unwritten by culled primitives
+        const unsigned int spare_vtx = reserved ? (unsigned int)(DrawList.VtxBuffer.Data + DrawList.VtxBuffer.Size - DrawList._VtxWritePtr) : 0;
+        const unsigned int spare_idx = reserved ? (unsigned int)(DrawList.IdxBuffer.Data + DrawList.IdxBuffer.Size - DrawList._IdxWritePtr) : 0;
         // find how many can be reserved up to end of current draw command's limit
         unsigned int cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - DrawList._VtxCurrentIdx) / Renderer::VtxConsumed);
         // make sure at least this many elements can be rendered to avoid situations where at the end of buffer this slow path is not taken all the time
         if (cnt >= ImMin(64u, prims)) {
-            if (prims_culled >= cnt)
-                prims_culled -= cnt; // reuse previous reservation
-            else {
-                DrawList.PrimReserve((cnt - prims_culled) * Renderer::IdxConsumed, (cnt - prims_culled) * Renderer::VtxConsumed); // add more elements to previous reservation
-                prims_culled = 0;
+            if (spare_vtx < cnt * Renderer::VtxConsumed || spare_idx < cnt * Renderer::IdxConsumed) {
+                // add more elements to previous reservation (PrimReserve writes after the end of the buffers, so drop the spare space first)
+                DrawList.PrimUnreserve(spare_idx, spare_vtx);
+                DrawList.PrimReserve(cnt * Renderer::IdxConsumed, cnt * Renderer::VtxConsumed);
+                reserved = true;
             }
         }
         else
         {
-            if (prims_culled > 0) {
-                DrawList.PrimUnreserve(prims_culled * Renderer::IdxConsumed, prims_culled * Renderer::VtxConsumed);
-                prims_culled = 0;
-            }
-            cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - 0/*DrawList._VtxCurrentIdx*/) / Renderer::VtxConsumed);
-            DrawList.PrimReserve(cnt * Renderer::IdxConsumed, cnt * Renderer::VtxConsumed); // reserve new draw command
+            DrawList.PrimUnreserve(spare_idx, spare_vtx);
+            // reserve new draw command, with one spare primitive's worth of vertices for renderers that re-emit their
+            // previous vertices to stay connected across the draw command boundary
+            cnt = ImMin(prims, MaxIdx<ImDrawIdx>::Value / Renderer::VtxConsumed - 1);
+            DrawList.PrimReserve(cnt * Renderer::IdxConsumed, (cnt + 1) * Renderer::VtxConsumed);
+            reserved = true;
         }
         prims -= cnt;
         for (unsigned int ie = idx + cnt; idx != ie; ++idx) {
             if (!renderer(DrawList, cull_rect, uv, idx))
-                prims_culled++;
+                total_culled++;
         }
     }
-    if (prims_culled > 0)
-        DrawList.PrimUnreserve(prims_culled * Renderer::IdxConsumed, prims_culled * Renderer::VtxConsumed);
+    if (reserved)
+        DrawList.PrimUnreserve((int)(DrawList.IdxBuffer.Data + DrawList.IdxBuffer.Size - DrawList._IdxWritePtr),
+                               (int)(DrawList.VtxBuffer.Data + DrawList.VtxBuffer.Size - DrawList._VtxWritePtr));
+    AddItemMetrics((int)renderer.Prims, (int)total_culled);
 }
 
 template <typename Getter, typename Transformer>
-inline void RenderLineStrip(Getter getter, Transformer transformer, ImDrawList& DrawList, float line_weight, ImU32 col) {
+inline void RenderLineStrip(Getter getter, Transformer transformer, ImDrawList& DrawList, float line_weight, ImU32 col, ImPlotLineJoin join = ImPlotLineJoin_None) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::RenderLineStrip");
     ImPlotContext& gp = *GImPlot;
     if (ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_AntiAliased) || gp.Style.AntiAliasedLines) {
-        ImVec2 p1 = transformer(getter(0));
-        for (int i = 1; i < getter.Count; ++i) {
-            ImVec2 p2 = transformer(getter(i));
-            if (gp.BB_Plot.Overlaps(ImRect(ImMin(p1, p2), ImMax(p1, p2))))
-                DrawList.AddLine(p1, p2, col, line_weight);
-            p1 = p2;
-        }
+        RenderPrimitives(LineStripRendererAA<Getter,Transformer>(getter, transformer, col, line_weight), DrawList, gp.BB_Plot);
+    }
+    else if (join == ImPlotLineJoin_Miter) {
+        RenderPrimitives(LineStripJoinRenderer<Getter,Transformer,false>(getter, transformer, col, line_weight), DrawList, gp.BB_Plot);
+    }
+    else if (join == ImPlotLineJoin_Bevel) {
+        RenderPrimitives(LineStripJoinRenderer<Getter,Transformer,true>(getter, transformer, col, line_weight), DrawList, gp.BB_Plot);
     }
     else {
         RenderPrimitives(LineStripRenderer<Getter,Transformer>(getter, transformer, col, line_weight), DrawList, gp.BB_Plot);
@@ -688,15 +948,10 @@ inline void RenderLineStrip(Getter getter, Transformer transformer, ImDrawList&
 
 template <typename Getter1, typename Getter2, typename Transformer>
 inline void RenderLineSegments(Getter1 getter1, Getter2 getter2, Transformer transformer, ImDrawList& DrawList, float line_weight, ImU32 col) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::RenderLineSegments");
     ImPlotContext& gp = *GImPlot;
     if (ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_AntiAliased) || gp.Style.AntiAliasedLines) {
-        int I = ImMin(getter1.Count, getter2.Count);
-        for (int i = 0; i < I; ++i) {
-            ImVec2 p1 = transformer(getter1(i));
-            ImVec2 p2 = transformer(getter2(i));
-            if (gp.BB_Plot.Overlaps(ImRect(ImMin(p1, p2), ImMax(p1, p2))))
-                DrawList.AddLine(p1, p2, col, line_weight);
-        }
+        RenderPrimitives(LineSegmentsRendererAA<Getter1,Getter2,Transformer>(getter1, getter2, transformer, col, line_weight), DrawList, gp.BB_Plot);
     }
     else {
         RenderPrimitives(LineSegmentsRenderer<Getter1,Getter2,Transformer>(getter1, getter2, transformer, col, line_weight), DrawList, gp.BB_Plot);
@@ -804,12 +1059,17 @@ inline void RenderMarkers(Getter getter, Transformer transformer, ImDrawList& Dr
         RenderMarkerPlus,
         RenderMarkerAsterisk
     };
+    IMPLOT_PROFILE_SCOPE("ImPlot::RenderMarkers");
     ImPlotContext& gp = *GImPlot;
+    int culled = 0;
     for (int i = 0; i < getter.Count; ++i) {
         ImVec2 c = transformer(getter(i));
         if (gp.BB_Plot.Contains(c))
             marker_table[marker](DrawList, c, size, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, weight);
+        else
+            culled++;
     }
+    AddItemMetrics(getter.Count, culled);
 }
 
 //-----------------------------------------------------------------------------
@@ -818,8 +1078,10 @@ inline void RenderMarkers(Getter getter, Transformer transformer, ImDrawList& Dr
 
 template <typename Getter>
 inline void PlotLineEx(const char* label_id, Getter getter) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotLine");
     if (BeginItem(label_id, ImPlotCol_Line)) {
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(p);
@@ -830,10 +1092,10 @@ inline void PlotLineEx(const char* label_id, Getter getter) {
         if (getter.Count > 1 && s.RenderLine) {
             const ImU32 col_line    = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
             switch (GetCurrentScale()) {
-                case ImPlotScale_LinLin: RenderLineStrip(getter, TransformerLinLin(), DrawList, s.LineWeight, col_line); break;
-                case ImPlotScale_LogLin: RenderLineStrip(getter, TransformerLogLin(), DrawList, s.LineWeight, col_line); break;
-                case ImPlotScale_LinLog: RenderLineStrip(getter, TransformerLinLog(), DrawList, s.LineWeight, col_line); break;
-                case ImPlotScale_LogLog: RenderLineStrip(getter, TransformerLogLog(), DrawList, s.LineWeight, col_line); break;
+                case ImPlotScale_LinLin: RenderLineStrip(getter, TransformerLinLin(), DrawList, s.LineWeight, col_line, s.LineJoin); break;
+                case ImPlotScale_LogLin: RenderLineStrip(getter, TransformerLogLin(), DrawList, s.LineWeight, col_line, s.LineJoin); break;
+                case ImPlotScale_LinLog: RenderLineStrip(getter, TransformerLinLog(), DrawList, s.LineWeight, col_line, s.LineJoin); break;
+                case ImPlotScale_LogLog: RenderLineStrip(getter, TransformerLogLog(), DrawList, s.LineWeight, col_line, s.LineJoin); break;
             }
         }
         // render markers
@@ -895,8 +1157,10 @@ void PlotLine(const char* label_id, ImPlotPoint (*getter_func)(void* data, int i
 
 template <typename Getter>
 inline void PlotScatterEx(const char* label_id, Getter getter) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotScatter");
     if (BeginItem(label_id, ImPlotCol_MarkerOutline)) {
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(p);
@@ -958,14 +1222,298 @@ void PlotScatter(const char* label_id, ImPlotPoint (*getter_func)(void* data, in
     return PlotScatterEx(label_id, getter);
 }
 
+//-----------------------------------------------------------------------------
+// PLOT SCATTER DENSITY
+//-----------------------------------------------------------------------------
+
+// Screen space grid of rectangular or (pointy-top, odd row shifted) hexagonal bins covering the plot area
+struct DensityGrid {
+    DensityGrid(const ImRect& bb, float bin_size, bool hexagonal) {
+        BB  = bb;
+        Hex = hexagonal;
+        R   = bin_size;
+        if (Hex) {
+            // pad by a cell on each side so hexagons overlapping the plot edges have valid indices
+            CellW  = 2 * SQRT_3_2 * R;
+            CellH  = 1.5f * R;
+            Origin = bb.Min - ImVec2(CellW, CellH);
+            Cols   = (int)(bb.GetWidth()  / CellW) + 4;
+            Rows   = (int)(bb.GetHeight() / CellH) + 4;
+        }
+        else {
+            CellW  = CellH = R;
+            Origin = bb.Min;
+            Cols   = (int)(bb.GetWidth()  / CellW) + 1;
+            Rows   = (int)(bb.GetHeight() / CellH) + 1;
+        }
+        InvW = 1.0f / CellW;
+        InvH = 1.0f / CellH;
+    }
+    // Returns the bin containing a pixel, or -1 if it is outside of the plot area (or NaN)
+    inline int Index(float px, float py) const {
+        if (!(px >= BB.Min.x && px < BB.Max.x && py >= BB.Min.y && py < BB.Max.y))
+            return -1;
+        const float x = px - Origin.x;
+        const float y = py - Origin.y;
+        if (!Hex)
+            return ImMin((int)(y * InvH), Rows - 1) * Cols + ImMin((int)(x * InvW), Cols - 1);
+        // pixel to fractional cube coordinates, rounded to the nearest hexagon, then to odd row offset coordinates
+        const float qf = (x * (2 * SQRT_3_2 / 3) - y / 3) / R;
+        const float rf = (y * (2.0f / 3)) / R;
+        const float sf = -qf - rf;
+        float q = ImFloor(qf + 0.5f), r = ImFloor(rf + 0.5f), s = ImFloor(sf + 0.5f);
+        const float dq = ImFabs(q - qf), dr = ImFabs(r - rf), ds = ImFabs(s - sf);
+        if (dq > dr && dq > ds)
+            q = -r - s;
+        else if (dr > ds)
+            r = -q - s;
+        const int row = (int)r;
+        const int col = (int)q + (row - (row & 1)) / 2;
+        return (row >= 0 && row < Rows && col >= 0 && col < Cols) ? row * Cols + col : -1;
+    }
+    inline ImVec2 Center(int row, int col) const {
+        return Hex ? Origin + ImVec2(CellW * (col + 0.5f * (row & 1)), CellH * row)
+                   : Origin + ImVec2(CellW * (col + 0.5f), CellH * (row + 0.5f));
+    }
+    ImRect BB;
+    ImVec2 Origin;
+    bool   Hex;
+    float  R, CellW, CellH, InvW, InvH;
+    int    Rows, Cols;
+};
+
+// Number of points whose bin indices are computed in one batch before counting, small enough to stay in L1
+#define IMPLOT_DENSITY_BATCH 256
+
+// Bins contiguous xs/ys on linear axes, using the same coefficients as TransformerLinLin. Bin indices are computed in
+// branch free batches (which compilers can vectorize) before the counts are scattered.
+template <typename T>
+void BinPointsLinLin(const T* xs, const T* ys, int first, int last, const DensityGrid& grid, int* counts) {
+    ImPlotContext& gp = *GImPlot;
+    const int y_axis = GetCurrentYAxis();
+    const double mx = gp.Mx, my = gp.My[y_axis];
+    const double ax = gp.PixelRange[y_axis].Min.x - mx * gp.CurrentPlot->XAxis.Range.Min;
+    const double ay = gp.PixelRange[y_axis].Min.y - my * gp.CurrentPlot->YAxis[y_axis].Range.Min;
+    int bins[IMPLOT_DENSITY_BATCH];
+    for (int i = first; i < last; i += IMPLOT_DENSITY_BATCH) {
+        const int n = ImMin(IMPLOT_DENSITY_BATCH, last - i);
+        for (int j = 0; j < n; ++j)
+            bins[j] = grid.Index((float)(ax + mx * (double)xs[i + j]), (float)(ay + my * (double)ys[i + j]));
+        for (int j = 0; j < n; ++j) {
+            if (bins[j] >= 0)
+                counts[bins[j]]++;
+        }
+    }
+}
+
+// Bins the points [first,last) from any getter and transformer
+template <typename Getter, typename Transformer>
+void BinPoints(Getter getter, Transformer transformer, int first, int last, const DensityGrid& grid, int* counts) {
+    for (int i = first; i < last; ++i) {
+        const ImVec2 p = transformer(getter(i));
+        const int bin = grid.Index(p.x, p.y);
+        if (bin >= 0)
+            counts[bin]++;
+    }
+}
+
+// Bins the raw indices [first,last) of xs/ys at the current plot transform. Samples are unordered, so ring buffers need
+// no offset. Only reads the plot state, so disjoint ranges can be binned concurrently into separate grids.
+template <typename T>
+void BinScatterDensity(const T* xs, const T* ys, int first, int last, int stride, const DensityGrid& grid, int* counts) {
+    if (GetCurrentScale() == ImPlotScale_LinLin && stride == (int)sizeof(T)) {
+        BinPointsLinLin(xs, ys, first, last, grid, counts);
+        return;
+    }
+    GetterXsYs<T> getter(xs, ys, last, 0, stride);
+    switch (GetCurrentScale()) {
+        case ImPlotScale_LinLin: BinPoints(getter, TransformerLinLin(), first, last, grid, counts); break;
+        case ImPlotScale_LogLin: BinPoints(getter, TransformerLogLin(), first, last, grid, counts); break;
+        case ImPlotScale_LinLog: BinPoints(getter, TransformerLinLog(), first, last, grid, counts); break;
+        case ImPlotScale_LogLog: BinPoints(getter, TransformerLogLog(), first, last, grid, counts); break;
+    }
+}
+
+// Renders one rectangle or hexagon per non-empty bin, colored by log(count) through a colormap lookup table
+template <bool Hex>
+struct DensityRenderer {
+    DensityRenderer(const DensityGrid& grid, const int* counts, const ImU32* lut, int lut_size, int max_count) :
+        Grid(grid), Counts(counts), Lut(lut), LutSize(lut_size)
+    {
+        Prims  = Grid.Rows * Grid.Cols;
+        LogMax = max_count > 1 ? 1.0f / ImLog10((float)max_count) : 0.0f;
+    }
+    inline bool operator()(ImDrawList& DrawList, const ImRect& /*cull_rect*/, const ImVec2& uv, int prim) {
+        const int count = Counts[prim];
+        if (count == 0)
+            return false;
+        const int   row = prim / Grid.Cols;
+        const int   col = prim % Grid.Cols;
+        const ImU32 c   = Lut[ImClamp((int)(ImLog10((float)count) * LogMax * (LutSize - 1) + 0.5f), 0, LutSize - 1)];
+        const ImVec2 ctr = Grid.Center(row, col);
+        if (Hex) {
+            const float rx = SQRT_3_2 * Grid.R, ry = 0.5f * Grid.R;
+            const ImVec2 corners[6] = { ImVec2(ctr.x, ctr.y - Grid.R), ImVec2(ctr.x + rx, ctr.y - ry), ImVec2(ctr.x + rx, ctr.y + ry),
+                                        ImVec2(ctr.x, ctr.y + Grid.R), ImVec2(ctr.x - rx, ctr.y + ry), ImVec2(ctr.x - rx, ctr.y - ry) };
+            for (int i = 0; i < 6; ++i) {
+                DrawList._VtxWritePtr[i].pos = corners[i];
+                DrawList._VtxWritePtr[i].uv  = uv;
+                DrawList._VtxWritePtr[i].col = c;
+            }
+            // fan of four triangles from the first corner
+            for (int i = 0; i < 4; ++i) {
+                DrawList._IdxWritePtr[3*i+0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+                DrawList._IdxWritePtr[3*i+1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + i + 1);
+                DrawList._IdxWritePtr[3*i+2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + i + 2);
+            }
+        }
+        else {
+            const ImVec2 h(Grid.CellW * 0.5f, Grid.CellH * 0.5f);
+            DrawList._VtxWritePtr[0].pos = ImVec2(ctr.x - h.x, ctr.y - h.y);
+            DrawList._VtxWritePtr[1].pos = ImVec2(ctr.x + h.x, ctr.y - h.y);
+            DrawList._VtxWritePtr[2].pos = ImVec2(ctr.x + h.x, ctr.y + h.y);
+            DrawList._VtxWritePtr[3].pos = ImVec2(ctr.x - h.x, ctr.y + h.y);
+            for (int i = 0; i < 4; ++i) {
+                DrawList._VtxWritePtr[i].uv  = uv;
+                DrawList._VtxWritePtr[i].col = c;
+            }
+            DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+            DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+            DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
+            DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+            DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
+            DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+        }
+        DrawList._VtxWritePtr   += VtxConsumed;
+        DrawList._IdxWritePtr   += IdxConsumed;
+        DrawList._VtxCurrentIdx += VtxConsumed;
+        return true;
+    }
+    const DensityGrid& Grid;
+    const int* Counts;
+    const ImU32* Lut;
+    int LutSize;
+    int Prims;
+    float LogMax;
+    static const int IdxConsumed = Hex ? 12 : 6;
+    static const int VtxConsumed = Hex ? 6  : 4;
+};
+
+// Renders the non-empty bins of #grid with the current colormap
+inline void RenderScatterDensity(const DensityGrid& grid, const int* counts, float fill_alpha) {
+    ImPlotContext& gp = *GImPlot;
+    const int bins = grid.Rows * grid.Cols;
+    int max_count = 0;
+    for (int i = 0; i < bins; ++i)
+        max_count = ImMax(max_count, counts[i]);
+    // sample the current colormap once instead of per bin
+    static const int lut_size = 64;
+    ImU32* lut = AllocFrame<ImU32>(lut_size);
+    for (int i = 0; i < lut_size; ++i) {
+        ImVec4 color = LerpColormap((float)i / (lut_size - 1));
+        color.w *= fill_alpha;
+        lut[i] = ImGui::GetColorU32(color);
+    }
+    ImDrawList& DrawList = *GetPlotDrawList();
+    if (grid.Hex)
+        RenderPrimitives(DensityRenderer<true>(grid, counts, lut, lut_size, max_count), DrawList, gp.BB_Plot);
+    else
+        RenderPrimitives(DensityRenderer<false>(grid, counts, lut, lut_size, max_count), DrawList, gp.BB_Plot);
+}
+
+template <typename T>
+void PlotScatterDensityEx(const char* label_id, const T* xs, const T* ys, int count, float bin_size, bool hexagonal, int offset, int stride) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotScatterDensity");
+    IM_ASSERT_USER_ERROR(bin_size >= 1, "Bin size must be at least one pixel!");
+    if (BeginItem(label_id, ImPlotCol_Fill)) {
+        GetterXsYs<T> getter(xs, ys, count, offset, stride);
+        if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
+            for (int i = 0; i < getter.Count; ++i) {
+                ImPlotPoint p = getter(i);
+                FitPoint(p);
+            }
+        }
+        const ImPlotItemStyle& s = GetItemStyle();
+        ImPlotContext& gp = *GImPlot;
+        if (count > 0 && s.RenderFill) {
+            const DensityGrid grid(gp.BB_Plot, bin_size, hexagonal);
+            const int bins = grid.Rows * grid.Cols;
+            int* counts = AllocFrame<int>(bins);
+            memset(counts, 0, bins * sizeof(int));
+            {
+                IMPLOT_PROFILE_SCOPE("ImPlot::BinPoints");
+                BinScatterDensity(xs, ys, 0, count, stride, grid, counts);
+            }
+            RenderScatterDensity(grid, counts, s.FillAlpha);
+        }
+        EndItem();
+    }
+}
+
+// float
+void PlotScatterDensity(const char* label_id, const float* xs, const float* ys, int count, float bin_size, bool hexagonal, int offset, int stride) {
+    return PlotScatterDensityEx(label_id, xs, ys, count, bin_size, hexagonal, offset, stride);
+}
+
+// double
+void PlotScatterDensity(const char* label_id, const double* xs, const double* ys, int count, float bin_size, bool hexagonal, int offset, int stride) {
+    return PlotScatterDensityEx(label_id, xs, ys, count, bin_size, hexagonal, offset, stride);
+}
+
+int GetScatterDensityBins(float bin_size, bool hexagonal) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "GetScatterDensityBins() needs to be called between BeginPlot() and EndPlot()!");
+    IM_ASSERT_USER_ERROR(bin_size >= 1, "Bin size must be at least one pixel!");
+    const DensityGrid grid(gp.BB_Plot, bin_size, hexagonal);
+    return grid.Rows * grid.Cols;
+}
+
+template <typename T>
+void CountScatterDensityRangeEx(const T* xs, const T* ys, int begin, int end, int* counts, float bin_size, bool hexagonal, int stride) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "CountScatterDensityRange() needs to be called between BeginPlot() and EndPlot()!");
+    IM_ASSERT_USER_ERROR(bin_size >= 1, "Bin size must be at least one pixel!");
+    const DensityGrid grid(gp.BB_Plot, bin_size, hexagonal);
+    BinScatterDensity(xs, ys, begin, end, stride, grid, counts);
+}
+
+// float
+void CountScatterDensityRange(const float* xs, const float* ys, int begin, int end, int* counts, float bin_size, bool hexagonal, int stride) {
+    return CountScatterDensityRangeEx(xs, ys, begin, end, counts, bin_size, hexagonal, stride);
+}
+
+// double
+void CountScatterDensityRange(const double* xs, const double* ys, int begin, int end, int* counts, float bin_size, bool hexagonal, int stride) {
+    return CountScatterDensityRangeEx(xs, ys, begin, end, counts, bin_size, hexagonal, stride);
+}
+
+void PlotScatterDensityCounts(const char* label_id, const int* counts, float bin_size, bool hexagonal) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotScatterDensity");
+    IM_ASSERT_USER_ERROR(bin_size >= 1, "Bin size must be at least one pixel!");
+    if (BeginItem(label_id, ImPlotCol_Fill)) {
+        const ImPlotItemStyle& s = GetItemStyle();
+        if (s.RenderFill)
+            RenderScatterDensity(DensityGrid(GImPlot->BB_Plot, bin_size, hexagonal), counts, s.FillAlpha);
+        EndItem();
+    }
+}
+
+void MergeBinCounts(int* counts, const int* partial, int count) {
+    for (int i = 0; i < count; ++i)
+        counts[i] += partial[i];
+}
+
 //-----------------------------------------------------------------------------
 // PLOT SHADED
 //-----------------------------------------------------------------------------
 
 template <typename Getter1, typename Getter2>
 inline void PlotShadedEx(const char* label_id, Getter1 getter1, Getter2 getter2) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotShaded");
     if (BeginItem(label_id, ImPlotCol_Fill)) {
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             for (int i = 0; i < ImMin(getter1.Count, getter2.Count); ++i) {
                 ImPlotPoint p1 = getter1(i);
                 ImPlotPoint p2 = getter2(i);
@@ -1040,9 +1588,11 @@ void PlotShaded(const char* label_id, ImPlotPoint (*g1)(void* data, int idx), vo
 
 template <typename Getter, typename TWidth>
 void PlotBarsEx(const char* label_id, Getter getter, TWidth width) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotBars");
     if (BeginItem(label_id, ImPlotCol_Fill)) {
         const TWidth half_width = width / 2;
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(ImPlotPoint(p.x - half_width, p.y));
@@ -1107,9 +1657,11 @@ void PlotBars(const char* label_id, ImPlotPoint (*getter_func)(void* data, int i
 
 template <typename Getter, typename THeight>
 void PlotBarsHEx(const char* label_id, Getter getter, THeight height) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotBarsH");
     if (BeginItem(label_id, ImPlotCol_Fill)) {
         const THeight half_height = height / 2;
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(ImPlotPoint(0, p.y - half_height));
@@ -1172,8 +1724,10 @@ void PlotBarsH(const char* label_id, ImPlotPoint (*getter_func)(void* data, int
 
 template <typename Getter>
 void PlotErrorBarsEx(const char* label_id, Getter getter) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotErrorBars");
     if (BeginItem(label_id)) {
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPointError e = getter(i);
                 FitPoint(ImPlotPoint(e.X , e.Y - e.Neg));
@@ -1227,8 +1781,10 @@ void PlotErrorBars(const char* label_id, const double* xs, const double* ys, con
 
 template <typename Getter>
 void PlotErrorBarsHEx(const char* label_id, Getter getter) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotErrorBarsH");
     if (BeginItem(label_id)) {
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPointError e = getter(i);
                 FitPoint(ImPlotPoint(e.X - e.Neg, e.Y));
@@ -1282,8 +1838,10 @@ void PlotErrorBarsH(const char* label_id, const double* xs, const double* ys, co
 
 template <typename GetterM, typename GetterB>
 inline void PlotStemsEx(const char* label_id, GetterM get_mark, GetterB get_base) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotStems");
     if (BeginItem(label_id, ImPlotCol_Line)) {
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             for (int i = 0; i < get_base.Count; ++i) {
                 FitPoint(get_mark(i));
                 FitPoint(get_base(i));
@@ -1342,87 +1900,451 @@ void PlotStems(const char* label_id, const double* xs, const double* ys, int cou
 }
 
 //-----------------------------------------------------------------------------
-// PLOT PIE CHART
+// PLOT HISTOGRAM
 //-----------------------------------------------------------------------------
 
-inline void RenderPieSlice(ImDrawList& DrawList, const ImPlotPoint& center, double radius, double a0, double a1, ImU32 col) {
-    static const float resolution = 50 / (2 * IM_PI);
-    static ImVec2 buffer[50];
-    buffer[0] = PlotToPixels(center);
-    int n = ImMax(3, (int)((a1 - a0) * resolution));
-    double da = (a1 - a0) / (n - 1);
-    for (int i = 0; i < n; ++i) {
-        double a = a0 + i * da;
-        buffer[i + 1] = PlotToPixels(center.x + radius * cos(a), center.y + radius * sin(a));
+// Upper bound on the number of bins an ImPlotBin_ rule may produce (protects against degenerate spreads)
+#define IMPLOT_HISTOGRAM_MAX_BINS 65536
+
+// Reads a strided histogram sample (samples are unordered, so no offset is needed)
+template <typename T>
+inline double HistogramSample(const T* values, int idx, int stride) {
+    return (double)*(const T*)(const void*)((const unsigned char*)values + (size_t)idx * stride);
+}
+
+static int CompareDoubles(const void* a, const void* b) {
+    const double da = *(const double*)a;
+    const double db = *(const double*)b;
+    return da < db ? -1 : (da > db ? 1 : 0);
+}
+
+// Returns the min/max of the finite samples, padded if degenerate
+template <typename T>
+ImPlotRange CalcHistogramExtents(const T* values, int count, int stride) {
+    ImPlotRange range(HUGE_VAL, -HUGE_VAL);
+    for (int i = 0; i < count; ++i) {
+        const double v = HistogramSample(values, i, stride);
+        if (!ImNanOrInf(v)) {
+            range.Min = ImMin(range.Min, v);
+            range.Max = ImMax(range.Max, v);
+        }
     }
-    DrawList.AddConvexPolyFilled(buffer, n + 1, col);
+    if (range.Min > range.Max)
+        return ImPlotRange(0, 1);
+    if (range.Min == range.Max)
+        return ImPlotRange(range.Min - 0.5, range.Max + 0.5);
+    return range;
 }
 
+// Returns the number of bins an ImPlotBin_ rule yields for the samples inside #range
 template <typename T>
-void PlotPieChartEx(const char** label_ids, const T* values, int count, T x, T y, T radius, bool normalize, const char* fmt, T angle0) {
-    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != NULL, "PlotPieChart() needs to be called between BeginPlot() and EndPlot()!");
-    ImDrawList & DrawList = *GetPlotDrawList();
-    T sum = 0;
-    for (int i = 0; i < count; ++i)
-        sum += values[i];
-    normalize = normalize || sum > 1.0f;
-    ImPlotPoint center(x,y);
-    PushPlotClipRect();
-    T a0 = angle0 * 2 * IM_PI / 360.0f;
-    T a1 = angle0 * 2 * IM_PI / 360.0f;
+int CalcHistogramBins(const T* values, int count, int stride, const ImPlotRange& range, ImPlotBin rule) {
+    int n = 0;
+    double sum = 0, sum_sq = 0;
     for (int i = 0; i < count; ++i) {
-        T percent = normalize ? values[i] / sum : values[i];
-        a1 = a0 + 2 * IM_PI * percent;
-        if (BeginItem(label_ids[i])) {
-            ImU32 col = ImGui::GetColorU32(GetCurrentItem()->Color);
-            if (percent < 0.5) {
-                RenderPieSlice(DrawList, center, radius, a0, a1, col);
-            }
-            else  {
-                RenderPieSlice(DrawList, center, radius, a0, a0 + (a1 - a0) * 0.5f, col);
-                RenderPieSlice(DrawList, center, radius, a0 + (a1 - a0) * 0.5f, a1, col);
-            }
-            EndItem();
+        const double v = HistogramSample(values, i, stride);
+        if (range.Contains(v)) {
+            sum    += v;
+            sum_sq += v * v;
+            n++;
         }
-        a0 = a1;
     }
-    if (fmt != NULL) {
-        a0 = angle0 * 2 * IM_PI / 360.0f;
-        a1 = angle0 * 2 * IM_PI / 360.0f;
-        char buffer[32];
-        for (int i = 0; i < count; ++i) {
-            ImPlotItem* item = GetItem(label_ids[i]);
-            T percent = normalize ? values[i] / sum : values[i];
-            a1 = a0 + 2 * IM_PI * percent;
-            if (item->Show) {
-                sprintf(buffer, fmt, values[i]);
-                ImVec2 size = ImGui::CalcTextSize(buffer);
-                T angle = a0 + (a1 - a0) * 0.5f;
-                ImVec2 pos = PlotToPixels(center.x + 0.5f * radius * cos(angle), center.y + 0.5f * radius * sin(angle));
-                ImU32 col = CalcTextColor(item->Color);
-                DrawList.AddText(pos - size * 0.5f, col, buffer);
-            }
-            a0 = a1;
+    if (n < 2 || range.Size() <= 0)
+        return 1;
+    double width = 0;
+    if (rule == ImPlotBin_Scott) {
+        const double mean = sum / n;
+        const double var  = ImMax(0.0, sum_sq / n - mean * mean);
+        width = 3.49 * sqrt(var) * pow((double)n, -1.0/3.0);
+    }
+    else if (rule == ImPlotBin_FreedmanDiaconis) {
+        double* sorted = AllocFrame<double>(n);
+        for (int i = 0, j = 0; i < count; ++i) {
+            const double v = HistogramSample(values, i, stride);
+            if (range.Contains(v))
+                sorted[j++] = v;
         }
+        qsort(sorted, (size_t)n, sizeof(double), CompareDoubles);
+        const double q1 = sorted[(n - 1) / 4];
+        const double q3 = sorted[(3 * (n - 1)) / 4];
+        width = 2.0 * (q3 - q1) * pow((double)n, -1.0/3.0);
     }
-    PopPlotClipRect();
+    else { // ImPlotBin_Sturges
+        return (int)ceil(log((double)n) / log(2.0)) + 1;
+    }
+    if (width <= 0)
+        return 1;
+    return (int)ImMin(ceil(range.Size() / width), (double)IMPLOT_HISTOGRAM_MAX_BINS);
 }
 
-// float
-void PlotPieChart(const char** label_ids, const float* values, int count, float x, float y, float radius, bool normalize, const char* fmt, float angle0) {
-    return PlotPieChartEx(label_ids, values, count, x, y, radius, normalize, fmt, angle0);
+// Counts the samples [first,last) into #bins uniform bins over [min,max] (max inclusive). Bin indices are computed in
+// branch free batches (which compilers can vectorize) before the counts are scattered.
+template <typename T>
+void CountHistogramUniform(const T* values, int first, int last, int stride, double min, double max, int bins, int* counts) {
+    const double scale = bins / (max - min);
+    int idx[IMPLOT_DENSITY_BATCH];
+    for (int i = first; i < last; i += IMPLOT_DENSITY_BATCH) {
+        const int n = ImMin(IMPLOT_DENSITY_BATCH, last - i);
+        for (int j = 0; j < n; ++j) {
+            const double v = HistogramSample(values, i + j, stride);
+            idx[j] = (v >= min && v <= max) ? ImMin((int)((v - min) * scale), bins - 1) : -1;
+        }
+        for (int j = 0; j < n; ++j) {
+            if (idx[j] >= 0)
+                counts[idx[j]]++;
+        }
+    }
 }
 
-// double
-void PlotPieChart(const char** label_ids, const double* values, int count, double x, double y, double radius, bool normalize, const char* fmt, double angle0) {
-    return PlotPieChartEx(label_ids, values, count, x, y, radius, normalize, fmt, angle0);
+// Counts the samples [first,last) into the bins defined by ascending #edges (last edge inclusive) with a binary search
+// per sample
+template <typename T>
+void CountHistogramEdges(const T* values, int first, int last, int stride, const double* edges, int bins, int* counts) {
+    for (int i = first; i < last; ++i) {
+        const double v = HistogramSample(values, i, stride);
+        if (!(v >= edges[0] && v <= edges[bins]))
+            continue;
+        int lo = 0, hi = bins;
+        while (hi - lo > 1) {
+            const int mid = (lo + hi) / 2;
+            if (v < edges[mid])
+                hi = mid;
+            else
+                lo = mid;
+        }
+        counts[lo]++;
+    }
 }
 
-//-----------------------------------------------------------------------------
-// PLOT HEATMAP
-//-----------------------------------------------------------------------------
+// Sets the edges of #bins bins, copied from #edges or spread uniformly over #range if it is NULL
+inline void SetHistogramEdges(ImVector<double>& out, int bins, const double* edges, const ImPlotRange& range) {
+    out.resize(bins + 1);
+    if (edges != NULL) {
+        memcpy(out.Data, edges, (size_t)(bins + 1) * sizeof(double));
+        return;
+    }
+    const double width = range.Size() / bins;
+    for (int i = 0; i < bins; ++i)
+        out[i] = range.Min + i * width;
+    out[bins] = range.Max;
+}
+
+// Converts raw counts into the heights of #cache per its flags
+inline void FinalizeHistogram(ImPlotHistogramCache& cache, const int* counts) {
+    const int bins = cache.Heights.Size;
+    double total = 0;
+    for (int i = 0; i < bins; ++i)
+        total += counts[i];
+    const bool density    = ImHasFlag(cache.Flags, ImPlotHistogramFlags_Density) && total > 0;
+    const bool cumulative = ImHasFlag(cache.Flags, ImPlotHistogramFlags_Cumulative);
+    double running = 0;
+    cache.MaxHeight = 0;
+    for (int i = 0; i < bins; ++i) {
+        double h = counts[i];
+        if (cumulative) {
+            running += h;
+            h = density ? running / total : running;
+        }
+        else if (density) {
+            h /= total * (cache.Edges[i + 1] - cache.Edges[i]);
+        }
+        cache.Heights[i] = h;
+        cache.MaxHeight  = ImMax(cache.MaxHeight, h);
+    }
+}
 
-template <typename T, typename Transformer>
+// Bins #values into #cache unless it already holds the result for the same input and settings
+template <typename T>
+void UpdateHistogram(ImPlotHistogramCache& cache, const T* values, int count, int stride, int bins, const double* edges, ImPlotHistogramFlags flags, ImPlotRange range) {
+    if (!ImHasFlag(flags, ImPlotHistogramFlags_NoCache) && cache.Matches(values, edges, count, stride, bins, flags, range))
+        return;
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHistogram/Bin");
+    cache.Data    = values;
+    cache.EdgesIn = edges;
+    cache.Count   = count;
+    cache.Stride  = stride;
+    cache.Bins    = bins;
+    cache.Flags   = flags;
+    cache.Range   = range;
+    cache.Valid   = true;
+    if (edges == NULL) {
+        if (ImNanOrInf(range.Min) || ImNanOrInf(range.Max))
+            range = CalcHistogramExtents(values, count, stride);
+        if (bins < 0)
+            bins = CalcHistogramBins(values, count, stride, range, bins);
+        bins = ImMax(bins, 1);
+    }
+    SetHistogramEdges(cache.Edges, bins, edges, range);
+    cache.Heights.resize(bins);
+    int* counts = AllocFrame<int>(bins);
+    memset(counts, 0, (size_t)bins * sizeof(int));
+    if (edges != NULL)
+        CountHistogramEdges(values, 0, count, stride, edges, bins, counts);
+    else
+        CountHistogramUniform(values, 0, count, stride, cache.Edges[0], cache.Edges[bins], bins, counts);
+    FinalizeHistogram(cache, counts);
+}
+
+// Takes bins counted by the caller into #cache. The cache is left invalid, since it is not keyed on any samples.
+inline void SetHistogramCounts(ImPlotHistogramCache& cache, const int* counts, int bins, const double* edges, ImPlotHistogramFlags flags, const ImPlotRange& range) {
+    cache.Flags = flags;
+    cache.Valid = false;
+    SetHistogramEdges(cache.Edges, bins, edges, range);
+    cache.Heights.resize(bins);
+    FinalizeHistogram(cache, counts);
+}
+
+// Interprets histogram bins as pairs of rectangle corners for RectRenderer
+struct GetterHistogramRects {
+    const double* Edges; const double* Heights; int Count;
+    GetterHistogramRects(const double* edges, const double* heights, int bins) { Edges = edges; Heights = heights; Count = 2 * bins; }
+    inline ImPlotPoint operator()(int idx) {
+        const int bin = idx / 2;
+        return (idx & 1) ? ImPlotPoint(Edges[bin + 1], Heights[bin]) : ImPlotPoint(Edges[bin], 0);
+    }
+};
+
+// Interprets histogram bins as the stepped outline of the histogram
+struct GetterHistogramOutline {
+    const double* Edges; const double* Heights; int Count;
+    GetterHistogramOutline(const double* edges, const double* heights, int bins) { Edges = edges; Heights = heights; Count = 2 * bins + 2; }
+    inline ImPlotPoint operator()(int idx) {
+        const int bins = Count / 2 - 1;
+        if (idx == 0)
+            return ImPlotPoint(Edges[0], 0);
+        if (idx == Count - 1)
+            return ImPlotPoint(Edges[bins], 0);
+        const int k = idx - 1;
+        return ImPlotPoint(Edges[k / 2 + (k & 1)], Heights[k / 2]);
+    }
+};
+
+// Fits and renders the bins of #cache as the current item
+inline void RenderHistogram(const ImPlotHistogramCache& cache) {
+    const int bins = cache.Heights.Size;
+    if (FitThisFrame()) {
+        IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
+        FitPoint(ImPlotPoint(cache.Edges[0], 0));
+        FitPoint(ImPlotPoint(cache.Edges[bins], cache.MaxHeight));
+    }
+    const ImPlotItemStyle& s = GetItemStyle();
+    ImDrawList& DrawList = *GetPlotDrawList();
+    ImU32 col_line  = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+    ImU32 col_fill  = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+    bool  rend_line = s.RenderLine;
+    if (s.RenderFill && col_line == col_fill)
+        rend_line = false;
+    // bins are batched through the primitive renderers instead of transformed one by one
+    if (s.RenderFill) {
+        GetterHistogramRects getter(cache.Edges.Data, cache.Heights.Data, bins);
+        switch (GetCurrentScale()) {
+            case ImPlotScale_LinLin: RenderPrimitives(RectRenderer<GetterHistogramRects,TransformerLinLin>(getter, TransformerLinLin(), col_fill), DrawList, GImPlot->BB_Plot); break;
+            case ImPlotScale_LogLin: RenderPrimitives(RectRenderer<GetterHistogramRects,TransformerLogLin>(getter, TransformerLogLin(), col_fill), DrawList, GImPlot->BB_Plot); break;
+            case ImPlotScale_LinLog: RenderPrimitives(RectRenderer<GetterHistogramRects,TransformerLinLog>(getter, TransformerLinLog(), col_fill), DrawList, GImPlot->BB_Plot); break;
+            case ImPlotScale_LogLog: RenderPrimitives(RectRenderer<GetterHistogramRects,TransformerLogLog>(getter, TransformerLogLog(), col_fill), DrawList, GImPlot->BB_Plot); break;
+        }
+    }
+    if (rend_line) {
+        GetterHistogramOutline getter(cache.Edges.Data, cache.Heights.Data, bins);
+        switch (GetCurrentScale()) {
+            case ImPlotScale_LinLin: RenderLineStrip(getter, TransformerLinLin(), DrawList, s.LineWeight, col_line, s.LineJoin); break;
+            case ImPlotScale_LogLin: RenderLineStrip(getter, TransformerLogLin(), DrawList, s.LineWeight, col_line, s.LineJoin); break;
+            case ImPlotScale_LinLog: RenderLineStrip(getter, TransformerLinLog(), DrawList, s.LineWeight, col_line, s.LineJoin); break;
+            case ImPlotScale_LogLog: RenderLineStrip(getter, TransformerLogLog(), DrawList, s.LineWeight, col_line, s.LineJoin); break;
+        }
+    }
+}
+
+template <typename T>
+double PlotHistogramEx(const char* label_id, const T* values, int count, int bins, const double* edges, ImPlotHistogramFlags flags, const ImPlotRange& range, int stride) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHistogram");
+    if (BeginItem(label_id, ImPlotCol_Fill)) {
+        ImPlotHistogramCache& cache = GetCurrentItemCache(GImPlot->CurrentPlot->HistogramCaches);
+        UpdateHistogram(cache, values, count, stride, bins, edges, flags, range);
+        RenderHistogram(cache);
+        EndItem();
+        return cache.MaxHeight;
+    }
+    const ImPlotHistogramCache* cache = GImPlot->CurrentPlot->HistogramCaches.GetByKey(ImGui::GetID(label_id));
+    return cache != NULL && cache->Valid ? cache->MaxHeight : 0;
+}
+
+// float
+double PlotHistogram(const char* label_id, const float* values, int count, int bins, ImPlotHistogramFlags flags, ImPlotRange range, int stride) {
+    return PlotHistogramEx(label_id, values, count, bins, NULL, flags, range, stride);
+}
+
+double PlotHistogram(const char* label_id, const float* values, int count, const double* edges, int edge_count, ImPlotHistogramFlags flags, int stride) {
+    IM_ASSERT_USER_ERROR(edge_count >= 2, "PlotHistogram() needs at least two bin edges!");
+    return PlotHistogramEx(label_id, values, count, edge_count - 1, edges, flags, ImPlotRange(edges[0], edges[edge_count - 1]), stride);
+}
+
+// double
+double PlotHistogram(const char* label_id, const double* values, int count, int bins, ImPlotHistogramFlags flags, ImPlotRange range, int stride) {
+    return PlotHistogramEx(label_id, values, count, bins, NULL, flags, range, stride);
+}
+
+double PlotHistogram(const char* label_id, const double* values, int count, const double* edges, int edge_count, ImPlotHistogramFlags flags, int stride) {
+    IM_ASSERT_USER_ERROR(edge_count >= 2, "PlotHistogram() needs at least two bin edges!");
+    return PlotHistogramEx(label_id, values, count, edge_count - 1, edges, flags, ImPlotRange(edges[0], edges[edge_count - 1]), stride);
+}
+
+// int
+double PlotHistogram(const char* label_id, const int* values, int count, int bins, ImPlotHistogramFlags flags, ImPlotRange range, int stride) {
+    return PlotHistogramEx(label_id, values, count, bins, NULL, flags, range, stride);
+}
+
+double PlotHistogram(const char* label_id, const int* values, int count, const double* edges, int edge_count, ImPlotHistogramFlags flags, int stride) {
+    IM_ASSERT_USER_ERROR(edge_count >= 2, "PlotHistogram() needs at least two bin edges!");
+    return PlotHistogramEx(label_id, values, count, edge_count - 1, edges, flags, ImPlotRange(edges[0], edges[edge_count - 1]), stride);
+}
+
+template <typename T>
+void CountHistogramRangeEx(const T* values, int begin, int end, int* counts, int bins, const double* edges, const ImPlotRange& range, int stride) {
+    if (edges != NULL)
+        CountHistogramEdges(values, begin, end, stride, edges, bins, counts);
+    else
+        CountHistogramUniform(values, begin, end, stride, range.Min, range.Max, bins, counts);
+}
+
+// float
+void CountHistogramRange(const float* values, int begin, int end, int* counts, int bins, ImPlotRange range, int stride) {
+    IM_ASSERT_USER_ERROR(bins >= 1 && range.Max > range.Min, "CountHistogramRange() needs a bin count and a finite range!");
+    CountHistogramRangeEx(values, begin, end, counts, bins, NULL, range, stride);
+}
+
+void CountHistogramRange(const float* values, int begin, int end, int* counts, const double* edges, int edge_count, int stride) {
+    IM_ASSERT_USER_ERROR(edge_count >= 2, "CountHistogramRange() needs at least two bin edges!");
+    CountHistogramRangeEx(values, begin, end, counts, edge_count - 1, edges, ImPlotRange(), stride);
+}
+
+// double
+void CountHistogramRange(const double* values, int begin, int end, int* counts, int bins, ImPlotRange range, int stride) {
+    IM_ASSERT_USER_ERROR(bins >= 1 && range.Max > range.Min, "CountHistogramRange() needs a bin count and a finite range!");
+    CountHistogramRangeEx(values, begin, end, counts, bins, NULL, range, stride);
+}
+
+void CountHistogramRange(const double* values, int begin, int end, int* counts, const double* edges, int edge_count, int stride) {
+    IM_ASSERT_USER_ERROR(edge_count >= 2, "CountHistogramRange() needs at least two bin edges!");
+    CountHistogramRangeEx(values, begin, end, counts, edge_count - 1, edges, ImPlotRange(), stride);
+}
+
+// int
+void CountHistogramRange(const int* values, int begin, int end, int* counts, int bins, ImPlotRange range, int stride) {
+    IM_ASSERT_USER_ERROR(bins >= 1 && range.Max > range.Min, "CountHistogramRange() needs a bin count and a finite range!");
+    CountHistogramRangeEx(values, begin, end, counts, bins, NULL, range, stride);
+}
+
+void CountHistogramRange(const int* values, int begin, int end, int* counts, const double* edges, int edge_count, int stride) {
+    IM_ASSERT_USER_ERROR(edge_count >= 2, "CountHistogramRange() needs at least two bin edges!");
+    CountHistogramRangeEx(values, begin, end, counts, edge_count - 1, edges, ImPlotRange(), stride);
+}
+
+inline double PlotHistogramCountsEx(const char* label_id, const int* counts, int bins, const double* edges, ImPlotHistogramFlags flags, const ImPlotRange& range) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHistogram");
+    if (BeginItem(label_id, ImPlotCol_Fill)) {
+        ImPlotHistogramCache& cache = GetCurrentItemCache(GImPlot->CurrentPlot->HistogramCaches);
+        SetHistogramCounts(cache, counts, bins, edges, flags, range);
+        RenderHistogram(cache);
+        EndItem();
+        return cache.MaxHeight;
+    }
+    return 0;
+}
+
+double PlotHistogramCounts(const char* label_id, const int* counts, int bins, ImPlotRange range, ImPlotHistogramFlags flags) {
+    IM_ASSERT_USER_ERROR(bins >= 1 && range.Max > range.Min, "PlotHistogramCounts() needs a bin count and a finite range!");
+    return PlotHistogramCountsEx(label_id, counts, bins, NULL, flags, range);
+}
+
+double PlotHistogramCounts(const char* label_id, const int* counts, const double* edges, int edge_count, ImPlotHistogramFlags flags) {
+    IM_ASSERT_USER_ERROR(edge_count >= 2, "PlotHistogramCounts() needs at least two bin edges!");
+    return PlotHistogramCountsEx(label_id, counts, edge_count - 1, edges, flags, ImPlotRange(edges[0], edges[edge_count - 1]));
+}
+
+//-----------------------------------------------------------------------------
+// PLOT PIE CHART
+//-----------------------------------------------------------------------------
+
+inline void RenderPieSlice(ImDrawList& DrawList, const ImPlotPoint& center, double radius, double a0, double a1, ImU32 col) {
+    static const float resolution = 50 / (2 * IM_PI);
+    int n = ImMax(3, (int)((a1 - a0) * resolution));
+    ImVec2* buffer = AllocFrame<ImVec2>(n + 1);
+    buffer[0] = PlotToPixels(center);
+    double da = (a1 - a0) / (n - 1);
+    for (int i = 0; i < n; ++i) {
+        double a = a0 + i * da;
+        buffer[i + 1] = PlotToPixels(center.x + radius * cos(a), center.y + radius * sin(a));
+    }
+    DrawList.AddConvexPolyFilled(buffer, n + 1, col);
+}
+
+template <typename T>
+void PlotPieChartEx(const char** label_ids, const T* values, int count, T x, T y, T radius, bool normalize, const char* fmt, T angle0) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotPieChart");
+    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != NULL, "PlotPieChart() needs to be called between BeginPlot() and EndPlot()!");
+    ImDrawList & DrawList = *GetPlotDrawList();
+    T sum = 0;
+    for (int i = 0; i < count; ++i)
+        sum += values[i];
+    normalize = normalize || sum > 1.0f;
+    ImPlotPoint center(x,y);
+    PushPlotClipRect();
+    T a0 = angle0 * 2 * IM_PI / 360.0f;
+    T a1 = angle0 * 2 * IM_PI / 360.0f;
+    for (int i = 0; i < count; ++i) {
+        T percent = normalize ? values[i] / sum : values[i];
+        a1 = a0 + 2 * IM_PI * percent;
+        if (BeginItem(label_ids[i])) {
+            ImU32 col = ImGui::GetColorU32(GetCurrentItem()->Color);
+            if (percent < 0.5) {
+                RenderPieSlice(DrawList, center, radius, a0, a1, col);
+            }
+            else  {
+                RenderPieSlice(DrawList, center, radius, a0, a0 + (a1 - a0) * 0.5f, col);
+                RenderPieSlice(DrawList, center, radius, a0 + (a1 - a0) * 0.5f, a1, col);
+            }
+            EndItem();
+        }
+        a0 = a1;
+    }
+    if (fmt != NULL) {
+        a0 = angle0 * 2 * IM_PI / 360.0f;
+        a1 = angle0 * 2 * IM_PI / 360.0f;
+        char buffer[32];
+        for (int i = 0; i < count; ++i) {
+            ImPlotItem* item = GetItem(label_ids[i]);
+            T percent = normalize ? values[i] / sum : values[i];
+            a1 = a0 + 2 * IM_PI * percent;
+            if (item->Show) {
+                sprintf(buffer, fmt, values[i]);
+                ImVec2 size = ImGui::CalcTextSize(buffer);
+                T angle = a0 + (a1 - a0) * 0.5f;
+                ImVec2 pos = PlotToPixels(center.x + 0.5f * radius * cos(angle), center.y + 0.5f * radius * sin(angle));
+                ImU32 col = CalcTextColor(item->Color);
+                DrawList.AddText(pos - size * 0.5f, col, buffer);
+            }
+            a0 = a1;
+        }
+    }
+    PopPlotClipRect();
+}
+
+// float
+void PlotPieChart(const char** label_ids, const float* values, int count, float x, float y, float radius, bool normalize, const char* fmt, float angle0) {
+    return PlotPieChartEx(label_ids, values, count, x, y, radius, normalize, fmt, angle0);
+}
+
+// double
+void PlotPieChart(const char** label_ids, const double* values, int count, double x, double y, double radius, bool normalize, const char* fmt, double angle0) {
+    return PlotPieChartEx(label_ids, values, count, x, y, radius, normalize, fmt, angle0);
+}
+
+//-----------------------------------------------------------------------------
+// PLOT HEATMAP
+//-----------------------------------------------------------------------------
+
+template <typename T, typename Transformer>
 void RenderHeatmap(Transformer transformer, ImDrawList& DrawList, const T* values, int rows, int cols, T scale_min, T scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max) {
     ImPlotContext& gp = *GImPlot;
     const double w = (bounds_max.x - bounds_min.x) / cols;
@@ -1467,9 +2389,11 @@ void RenderHeatmap(Transformer transformer, ImDrawList& DrawList, const T* value
 
 template <typename T>
 void PlotHeatmapEx(const char* label_id, const T* values, int rows, int cols, T scale_min, T scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHeatmap");
     IM_ASSERT_USER_ERROR(scale_min != scale_max, "Scale values must be different!");
     if (BeginItem(label_id)) {
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             FitPoint(bounds_min);
             FitPoint(bounds_max);
         }
@@ -1494,63 +2418,392 @@ void PlotHeatmap(const char* label_id, const double* values, int rows, int cols,
     return PlotHeatmapEx(label_id, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max);
 }
 
+//-----------------------------------------------------------------------------
+// PLOT HISTOGRAM 2D
+//-----------------------------------------------------------------------------
+
+// Counts the xs/ys samples [first,last) into a rows x cols grid over #bounds (max inclusive), with the first row at the
+// top. Flat bin indices are computed in branch free batches (which compilers can vectorize) before the counts are
+// scattered, so the sample streams and the grid are never touched in the same loop.
+template <typename T>
+void CountHistogram2D(const T* xs, const T* ys, int first, int last, int stride, const ImPlotLimits& bounds, int rows, int cols, int* counts) {
+    const double x0 = bounds.X.Min, x1 = bounds.X.Max, sx = cols / bounds.X.Size();
+    const double y0 = bounds.Y.Min, y1 = bounds.Y.Max, sy = rows / bounds.Y.Size();
+    int idx[IMPLOT_DENSITY_BATCH];
+    for (int i = first; i < last; i += IMPLOT_DENSITY_BATCH) {
+        const int n = ImMin(IMPLOT_DENSITY_BATCH, last - i);
+        for (int j = 0; j < n; ++j) {
+            const double x = HistogramSample(xs, i + j, stride);
+            const double y = HistogramSample(ys, i + j, stride);
+            idx[j] = (x >= x0 && x <= x1 && y >= y0 && y <= y1)
+                   ? (rows - 1 - ImMin((int)((y - y0) * sy), rows - 1)) * cols + ImMin((int)((x - x0) * sx), cols - 1)
+                   : -1;
+        }
+        for (int j = 0; j < n; ++j) {
+            if (idx[j] >= 0)
+                counts[idx[j]]++;
+        }
+    }
+}
+
+// Converts raw counts into the values of #cache per #flags, over its bounds and grid
+inline void FinalizeHistogram2D(ImPlotHistogram2DCache& cache, const int* counts, ImPlotHistogramFlags flags) {
+    const int bins = cache.Rows * cache.Cols;
+    cache.Values.resize(bins);
+    double total = 0;
+    for (int i = 0; i < bins; ++i)
+        total += counts[i];
+    const double norm = ImHasFlag(flags, ImPlotHistogramFlags_Density) && total > 0
+                      ? 1.0 / (total * (cache.Bounds.X.Size() / cache.Cols) * (cache.Bounds.Y.Size() / cache.Rows)) : 1.0;
+    cache.MaxHeight = 0;
+    for (int i = 0; i < bins; ++i) {
+        cache.Values[i] = counts[i] * norm;
+        cache.MaxHeight = ImMax(cache.MaxHeight, cache.Values[i]);
+    }
+}
+
+// Bins xs/ys into #cache unless it already holds the result for the same input and settings
+template <typename T>
+void UpdateHistogram2D(ImPlotHistogram2DCache& cache, const T* xs, const T* ys, int count, int stride, int x_bins, int y_bins, ImPlotHistogramFlags flags, ImPlotLimits range) {
+    if (!ImHasFlag(flags, ImPlotHistogramFlags_NoCache) && cache.Matches(xs, ys, count, stride, x_bins, y_bins, flags, range))
+        return;
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHistogram2D/Bin");
+    // extents are refreshed whenever the data may have changed (including in place with ImPlotHistogramFlags_NoCache)
+    // or they become an auto range, so that samples outside the first frame's extents are never dropped
+    const bool auto_x  = ImNanOrInf(range.X.Min) || ImNanOrInf(range.X.Max);
+    const bool auto_y  = ImNanOrInf(range.Y.Min) || ImNanOrInf(range.Y.Max);
+    const bool changed = !cache.Valid || cache.DataX != xs || cache.DataY != ys || cache.Count != count || cache.Stride != stride
+                      || ImHasFlag(flags, ImPlotHistogramFlags_NoCache);
+    if (changed || auto_x)
+        cache.Extents.X = CalcHistogramExtents(xs, count, stride);
+    if (changed || auto_y)
+        cache.Extents.Y = CalcHistogramExtents(ys, count, stride);
+    cache.DataX  = xs;
+    cache.DataY  = ys;
+    cache.Count  = count;
+    cache.Stride = stride;
+    cache.XBins  = x_bins;
+    cache.YBins  = y_bins;
+    cache.Flags  = flags;
+    cache.Range  = range;
+    cache.Valid  = true;
+    if (auto_x)
+        range.X = cache.Extents.X;
+    if (auto_y)
+        range.Y = cache.Extents.Y;
+    if (x_bins < 0)
+        x_bins = CalcHistogramBins(xs, count, stride, range.X, x_bins);
+    if (y_bins < 0)
+        y_bins = CalcHistogramBins(ys, count, stride, range.Y, y_bins);
+    cache.Bounds = range;
+    cache.Cols   = ImMax(x_bins, 1);
+    cache.Rows   = ImMax(y_bins, 1);
+    const int bins = cache.Rows * cache.Cols;
+    int* counts = AllocFrame<int>(bins);
+    memset(counts, 0, (size_t)bins * sizeof(int));
+    if (range.X.Size() > 0 && range.Y.Size() > 0)
+        CountHistogram2D(xs, ys, 0, count, stride, range, cache.Rows, cache.Cols, counts);
+    FinalizeHistogram2D(cache, counts, flags);
+}
+
+// Renders the values of #cache as a heatmap over its bounds
+inline void RenderHistogram2D(const ImPlotHistogram2DCache& cache) {
+    const double scale_max = cache.MaxHeight > 0 ? cache.MaxHeight : 1;
+    const ImPlotPoint bounds_min(cache.Bounds.X.Min, cache.Bounds.Y.Min);
+    const ImPlotPoint bounds_max(cache.Bounds.X.Max, cache.Bounds.Y.Max);
+    ImDrawList& DrawList = *GetPlotDrawList();
+    switch (GetCurrentScale()) {
+        case ImPlotScale_LinLin: RenderHeatmap(TransformerLinLin(), DrawList, cache.Values.Data, cache.Rows, cache.Cols, 0.0, scale_max, NULL, bounds_min, bounds_max); break;
+        case ImPlotScale_LogLin: RenderHeatmap(TransformerLogLin(), DrawList, cache.Values.Data, cache.Rows, cache.Cols, 0.0, scale_max, NULL, bounds_min, bounds_max); break;
+        case ImPlotScale_LinLog: RenderHeatmap(TransformerLinLog(), DrawList, cache.Values.Data, cache.Rows, cache.Cols, 0.0, scale_max, NULL, bounds_min, bounds_max); break;
+        case ImPlotScale_LogLog: RenderHeatmap(TransformerLogLog(), DrawList, cache.Values.Data, cache.Rows, cache.Cols, 0.0, scale_max, NULL, bounds_min, bounds_max); break;
+    }
+}
+
+template <typename T>
+double PlotHistogram2DEx(const char* label_id, const T* xs, const T* ys, int count, int x_bins, int y_bins, ImPlotHistogramFlags flags, ImPlotLimits range, int stride) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHistogram2D");
+    if (BeginItem(label_id)) {
+        ImPlotContext& gp = *GImPlot;
+        ImPlotHistogram2DCache& cache = GetCurrentItemCache(gp.CurrentPlot->Histogram2DCaches);
+        // binning the visible range keys the cache on the axes limits, so panning or zooming rebins
+        if (ImHasFlag(flags, ImPlotHistogramFlags_Visible)) {
+            range.X = gp.CurrentPlot->XAxis.Range;
+            range.Y = gp.CurrentPlot->YAxis[GetCurrentYAxis()].Range;
+        }
+        UpdateHistogram2D(cache, xs, ys, count, stride, x_bins, y_bins, flags, range);
+        if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
+            const ImPlotLimits& fit = ImHasFlag(flags, ImPlotHistogramFlags_Visible) ? cache.Extents : cache.Bounds;
+            FitPoint(ImPlotPoint(fit.X.Min, fit.Y.Min));
+            FitPoint(ImPlotPoint(fit.X.Max, fit.Y.Max));
+        }
+        RenderHistogram2D(cache);
+        EndItem();
+        return cache.MaxHeight;
+    }
+    const ImPlotHistogram2DCache* cache = GImPlot->CurrentPlot->Histogram2DCaches.GetByKey(ImGui::GetID(label_id));
+    return cache != NULL && cache->Valid ? cache->MaxHeight : 0;
+}
+
+// float
+double PlotHistogram2D(const char* label_id, const float* xs, const float* ys, int count, int x_bins, int y_bins, ImPlotHistogramFlags flags, ImPlotLimits range, int stride) {
+    return PlotHistogram2DEx(label_id, xs, ys, count, x_bins, y_bins, flags, range, stride);
+}
+
+// double
+double PlotHistogram2D(const char* label_id, const double* xs, const double* ys, int count, int x_bins, int y_bins, ImPlotHistogramFlags flags, ImPlotLimits range, int stride) {
+    return PlotHistogram2DEx(label_id, xs, ys, count, x_bins, y_bins, flags, range, stride);
+}
+
+// int
+double PlotHistogram2D(const char* label_id, const int* xs, const int* ys, int count, int x_bins, int y_bins, ImPlotHistogramFlags flags, ImPlotLimits range, int stride) {
+    return PlotHistogram2DEx(label_id, xs, ys, count, x_bins, y_bins, flags, range, stride);
+}
+
+template <typename T>
+void CountHistogram2DRangeEx(const T* xs, const T* ys, int begin, int end, int* counts, int x_bins, int y_bins, const ImPlotLimits& range, int stride) {
+    IM_ASSERT_USER_ERROR(x_bins >= 1 && y_bins >= 1 && range.X.Max > range.X.Min && range.Y.Max > range.Y.Min, "CountHistogram2DRange() needs bin counts and a finite range!");
+    CountHistogram2D(xs, ys, begin, end, stride, range, y_bins, x_bins, counts);
+}
+
+// float
+void CountHistogram2DRange(const float* xs, const float* ys, int begin, int end, int* counts, int x_bins, int y_bins, ImPlotLimits range, int stride) {
+    return CountHistogram2DRangeEx(xs, ys, begin, end, counts, x_bins, y_bins, range, stride);
+}
+
+// double
+void CountHistogram2DRange(const double* xs, const double* ys, int begin, int end, int* counts, int x_bins, int y_bins, ImPlotLimits range, int stride) {
+    return CountHistogram2DRangeEx(xs, ys, begin, end, counts, x_bins, y_bins, range, stride);
+}
+
+// int
+void CountHistogram2DRange(const int* xs, const int* ys, int begin, int end, int* counts, int x_bins, int y_bins, ImPlotLimits range, int stride) {
+    return CountHistogram2DRangeEx(xs, ys, begin, end, counts, x_bins, y_bins, range, stride);
+}
+
+double PlotHistogram2DCounts(const char* label_id, const int* counts, int x_bins, int y_bins, ImPlotLimits range, ImPlotHistogramFlags flags) {
+    IM_ASSERT_USER_ERROR(x_bins >= 1 && y_bins >= 1 && range.X.Max > range.X.Min && range.Y.Max > range.Y.Min, "PlotHistogram2DCounts() needs bin counts and a finite range!");
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHistogram2D");
+    if (BeginItem(label_id)) {
+        // the counts are not keyed on any samples, so the next PlotHistogram2D of this item rebins
+        ImPlotHistogram2DCache& cache = GetCurrentItemCache(GImPlot->CurrentPlot->Histogram2DCaches);
+        cache.Valid  = false;
+        cache.Bounds = range;
+        cache.Cols   = x_bins;
+        cache.Rows   = y_bins;
+        FinalizeHistogram2D(cache, counts, flags);
+        if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
+            FitPoint(ImPlotPoint(range.X.Min, range.Y.Min));
+            FitPoint(ImPlotPoint(range.X.Max, range.Y.Max));
+        }
+        RenderHistogram2D(cache);
+        EndItem();
+        return cache.MaxHeight;
+    }
+    return 0;
+}
+
 //-----------------------------------------------------------------------------
 // PLOT DIGITAL
 //-----------------------------------------------------------------------------
 
-// TODO: Make this behave like all the other plot types
+// Gap in pixels between the first digital channel and the bottom of the plot (leaves room for the mouse position label)
+#define IMPLOT_DIGITAL_OFFSET 20
+
+// A run (or band of coalesced runs) of a digital channel, in pixels
+struct DigitalRect {
+    ImVec2 Min, Max;
+    ImU32  Col;
+};
+
+// Collects the rects of a digital channel, clipped horizontally to the plot area
+struct DigitalRectBuffer {
+    DigitalRectBuffer(int capacity, float clip_min, float clip_max, float base) {
+        Data = AllocFrame<DigitalRect>(capacity); Size = 0; Capacity = capacity;
+        ClipMin = clip_min; ClipMax = clip_max; Base = base;
+    }
+    inline void Push(float x0, float x1, int height, ImU32 col) {
+        if (x0 > x1)
+            ImSwap(x0, x1);
+        x0 = ImMax(x0, ClipMin);
+        x1 = ImMin(x1, ClipMax);
+        if (x1 <= x0 || Size == Capacity)
+            return;
+        DigitalRect& r = Data[Size++];
+        r.Min = ImVec2(x0, Base - height);
+        r.Max = ImVec2(x1, Base);
+        r.Col = col;
+    }
+    DigitalRect* Data;
+    int Size;
+    int Capacity;
+    float ClipMin, ClipMax, Base;
+};
+
+// Renders the rects collected for a digital channel
+struct DigitalRenderer {
+    inline DigitalRenderer(const DigitalRect* rects, int count) : Rects(rects) {
+        Prims = count;
+    }
+    inline bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) {
+        const DigitalRect& r = Rects[prim];
+        if (r.Max.y < cull_rect.Min.y || r.Min.y > cull_rect.Max.y)
+            return false;
+        DrawList._VtxWritePtr[0].pos   = r.Min;
+        DrawList._VtxWritePtr[0].uv    = uv;
+        DrawList._VtxWritePtr[0].col   = r.Col;
+        DrawList._VtxWritePtr[1].pos.x = r.Min.x;
+        DrawList._VtxWritePtr[1].pos.y = r.Max.y;
+        DrawList._VtxWritePtr[1].uv    = uv;
+        DrawList._VtxWritePtr[1].col   = r.Col;
+        DrawList._VtxWritePtr[2].pos   = r.Max;
+        DrawList._VtxWritePtr[2].uv    = uv;
+        DrawList._VtxWritePtr[2].col   = r.Col;
+        DrawList._VtxWritePtr[3].pos.x = r.Max.x;
+        DrawList._VtxWritePtr[3].pos.y = r.Min.y;
+        DrawList._VtxWritePtr[3].uv    = uv;
+        DrawList._VtxWritePtr[3].col   = r.Col;
+        DrawList._VtxWritePtr += 4;
+        DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+        DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+        DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+        DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+        DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
+        DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+        DrawList._IdxWritePtr   += 6;
+        DrawList._VtxCurrentIdx += 4;
+        return true;
+    }
+    const DigitalRect* Rects;
+    int Prims;
+    static const int IdxConsumed = 6;
+    static const int VtxConsumed = 4;
+};
+
+// Interprets the transitions of an ImPlotDigitalChannel as digital samples, followed by a NAN sample at its end time (an
+// empty channel has no samples, so it is neither drawn nor fitted)
+struct GetterDigitalChannel {
+    const double* Times; const float* States; double EndTime; int Count;
+    GetterDigitalChannel(const ImPlotDigitalChannel& channel) {
+        Times = channel.Times.Data; States = channel.States.Data; EndTime = channel.EndTime; Count = channel.Times.Size > 0 ? channel.Times.Size + 1 : 0;
+    }
+    inline ImPlotPoint operator()(int idx) {
+        return idx < Count - 1 ? ImPlotPoint(Times[idx], (double)States[idx]) : ImPlotPoint(EndTime, NAN);
+    }
+};
+
+// Returns the first index in [first,last) whose x is not less than #x (xs must be sorted in ascending order)
+template <typename Getter>
+inline int LowerBoundX(Getter& getter, int first, int last, double x) {
+    while (first < last) {
+        const int mid = first + (last - first) / 2;
+        if (getter(mid).x < x)
+            first = mid + 1;
+        else
+            last = mid;
+    }
+    return first;
+}
+
+// Renders the visible runs of a digital channel. Sample i holds its value until sample i+1. Only the samples inside the
+// x-axis limits are visited, and runs narrower than a pixel are coalesced into a translucent "busy" band, skipping
+// straight to the next pixel column with a binary search. Returns the height the channel occupies.
+template <typename Getter, typename Transformer>
+int RenderDigital(Getter getter, Transformer transformer, ImDrawList& DrawList, const ImPlotItemStyle& s) {
+    ImPlotContext& gp = *GImPlot;
+    const int y_axis = GetCurrentYAxis();
+    const ImPlotRange& range = gp.CurrentPlot->XAxis.Range;
+    const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+    ImVec4 busy = s.Colors[ImPlotCol_Fill];
+    busy.w *= 0.5f;
+    const ImU32 col_busy = ImGui::GetColorU32(busy);
+    // pixel direction of increasing x (negative for inverted axes)
+    const float dir = gp.PixelRange[y_axis].Max.x >= gp.PixelRange[y_axis].Min.x ? 1.0f : -1.0f;
+    // visible samples, including the runs that cross the axis limits
+    const int first = ImMax(LowerBoundX(getter, 0, getter.Count, range.Min) - 1, 0);
+    const int last  = ImMin(LowerBoundX(getter, first, getter.Count, range.Max) + 1, getter.Count);
+    // every rect (or band and rect pair) spans at least one pixel, which bounds the buffer by the plot width
+    DigitalRectBuffer rects(2 * ((int)gp.BB_Plot.GetWidth() + 4), gp.BB_Plot.Min.x, gp.BB_Plot.Max.x,
+                            gp.PixelRange[y_axis].Min.y - gp.DigitalPlotOffset - IMPLOT_DIGITAL_OFFSET);
+    int   pix_y_max = (int)(s.DigitalBitHeight + s.DigitalBitGap);
+    bool  band      = false;
+    float band_min  = 0;
+    float band_max  = 0;
+    int   band_h    = 0;
+    int i = first;
+    while (i < last - 1) {
+        const ImPlotPoint p = getter(i);
+        if (ImNanOrInf(p.y)) {
+            i++;
+            continue;
+        }
+        // plot only one rectangle for the same digital state
+        int j = i + 1;
+        ImPlotPoint q = getter(j);
+        while (j < last - 1 && q.y == p.y)
+            q = getter(++j);
+        const float level = s.DigitalBitHeight * (float)ImMax(0.0, p.y);
+        const int   h     = (int)s.LineWeight + (int)level;
+        pix_y_max = ImMax(pix_y_max, (int)(ImMax(s.DigitalBitHeight, level) + s.DigitalBitGap));
+        const float pa = transformer(p).x;
+        const float pb = transformer(q).x;
+        if (ImAbs(pb - pa) < 1) {
+            if (!band) {
+                band     = true;
+                band_min = pa;
+                band_h   = 0;
+            }
+            band_max = pb;
+            band_h   = ImMax(band_h, h);
+            // skip the samples that fall in the same pixel column
+            const int k = LowerBoundX(getter, j, last - 1, PixelsToPlot(pb + dir, 0, y_axis).x);
+            if (k - 1 > j) {
+                band_max = transformer(getter(k - 1)).x;
+                i = k - 1;
+            }
+            else {
+                i = j;
+            }
+            continue;
+        }
+        if (band) {
+            rects.Push(band_min, ImAbs(pa - band_min) < 1 ? band_min + dir : pa, band_h, col_busy);
+            band = false;
+        }
+        rects.Push(pa, pb, h, col_fill);
+        i = j;
+    }
+    if (band)
+        rects.Push(band_min, ImAbs(band_max - band_min) < 1 ? band_min + dir : band_max, band_h, col_busy);
+    RenderPrimitives(DigitalRenderer(rects.Data, rects.Size), DrawList, gp.BB_Plot);
+    return pix_y_max;
+}
 
 template <typename Getter>
 inline void PlotDigitalEx(const char* label_id, Getter getter) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotDigital");
     if (BeginItem(label_id, ImPlotCol_Fill)) {
+        // digital plots do not respond to y drag or zoom, so only the x-axis is fitted
+        if (FitThisFrame() && getter.Count > 0) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
+            FitPoint(ImPlotPoint(getter(0).x, NAN));
+            FitPoint(ImPlotPoint(getter(getter.Count - 1).x, NAN));
+        }
         ImPlotContext& gp = *GImPlot;
         ImDrawList& DrawList = *GetPlotDrawList();
         const ImPlotItemStyle& s = GetItemStyle();
         if (getter.Count > 1 && s.RenderFill) {
-            const int y_axis = GetCurrentYAxis();
-            int pixYMax = 0;
-            ImPlotPoint itemData1 = getter(0);
-            for (int i = 0; i < getter.Count; ++i) {
-                ImPlotPoint itemData2 = getter(i);
-                if (ImNanOrInf(itemData1.y)) {
-                    itemData1 = itemData2;
-                    continue;
-                }
-                if (ImNanOrInf(itemData2.y)) itemData2.y = ImConstrainNan(ImConstrainInf(itemData2.y));
-                int pixY_0 = (int)(s.LineWeight);
-                itemData1.y = ImMax(0.0, itemData1.y);
-                float pixY_1_float = s.DigitalBitHeight * (float)itemData1.y;
-                int pixY_1 = (int)(pixY_1_float); //allow only positive values
-                int pixY_chPosOffset = (int)(ImMax(s.DigitalBitHeight, pixY_1_float) + s.DigitalBitGap);
-                pixYMax = ImMax(pixYMax, pixY_chPosOffset);
-                ImVec2 pMin = PlotToPixels(itemData1);
-                ImVec2 pMax = PlotToPixels(itemData2);
-                int pixY_Offset = 20; //20 pixel from bottom due to mouse cursor label
-                pMin.y = (gp.PixelRange[y_axis].Min.y) + ((-gp.DigitalPlotOffset)                   - pixY_Offset);
-                pMax.y = (gp.PixelRange[y_axis].Min.y) + ((-gp.DigitalPlotOffset) - pixY_0 - pixY_1 - pixY_Offset);
-                //plot only one rectangle for same digital state
-                while (((i+2) < getter.Count) && (itemData1.y == itemData2.y)) {
-                    const int in = (i + 1);
-                    itemData2 = getter(in);
-                    if (ImNanOrInf(itemData2.y)) break;
-                    pMax.x = PlotToPixels(itemData2).x;
-                    i++;
-                }
-                //do not extend plot outside plot range
-                if (pMin.x < gp.PixelRange[y_axis].Min.x) pMin.x = gp.PixelRange[y_axis].Min.x;
-                if (pMax.x < gp.PixelRange[y_axis].Min.x) pMax.x = gp.PixelRange[y_axis].Min.x;
-                if (pMin.x > gp.PixelRange[y_axis].Max.x) pMin.x = gp.PixelRange[y_axis].Max.x;
-                if (pMax.x > gp.PixelRange[y_axis].Max.x) pMax.x = gp.PixelRange[y_axis].Max.x;
-                //plot a rectangle that extends up to x2 with y1 height
-                if ((pMax.x > pMin.x) && (gp.BB_Plot.Contains(pMin) || gp.BB_Plot.Contains(pMax))) {
-                    // ImVec4 colAlpha = item->Color;
-                    // colAlpha.w = item->Highlight ? 1.0f : 0.9f;
-                    DrawList.AddRectFilled(pMin, pMax, ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]));
-                }
-                itemData1 = itemData2;
+            int pix_y_max = 0;
+            switch (GetCurrentScale()) {
+                case ImPlotScale_LinLin: pix_y_max = RenderDigital(getter, TransformerLinLin(), DrawList, s); break;
+                case ImPlotScale_LogLin: pix_y_max = RenderDigital(getter, TransformerLogLin(), DrawList, s); break;
+                case ImPlotScale_LinLog: pix_y_max = RenderDigital(getter, TransformerLinLog(), DrawList, s); break;
+                case ImPlotScale_LogLog: pix_y_max = RenderDigital(getter, TransformerLogLog(), DrawList, s); break;
             }
             gp.DigitalPlotItemCnt++;
-            gp.DigitalPlotOffset += pixYMax;
+            gp.DigitalPlotOffset += pix_y_max;
         }
         EndItem();
     }
@@ -1574,13 +2827,204 @@ void PlotDigital(const char* label_id, ImPlotPoint (*getter_func)(void* data, in
     return PlotDigitalEx(label_id, getter);
 }
 
+// run-length encoded
+void PlotDigital(const char* label_id, const ImPlotDigitalChannel& channel) {
+    GetterDigitalChannel getter(channel);
+    return PlotDigitalEx(label_id, getter);
+}
+
+//-----------------------------------------------------------------------------
+// PLOT CANDLESTICK
+//-----------------------------------------------------------------------------
+
+// Candles narrower than this many pixels apart are aggregated into coarser time buckets
+#define IMPLOT_CANDLE_MIN_PITCH 4.0f
+
+// Interprets separate (or interleaved, with #stride) arrays of times, opens, closes, lows and highs as candles
+// Candles take their half widths from #half_widths if given, otherwise they all share #half_width
+struct GetterCandles {
+    const double* Xs; const double* Opens; const double* Closes; const double* Lows; const double* Highs; const double* HalfWidths; double HalfWidth; int Count; int Stride;
+    GetterCandles(const double* xs, const double* opens, const double* closes, const double* lows, const double* highs, int count, int stride, double half_width, const double* half_widths = NULL) {
+        Xs = xs; Opens = opens; Closes = closes; Lows = lows; Highs = highs; HalfWidths = half_widths; HalfWidth = half_width; Count = count; Stride = stride;
+    }
+    inline ImPlotCandle operator()(int idx) {
+        ImPlotCandle c;
+        c.X     = OffsetAndStride(Xs,     idx, Count, 0, Stride);
+        c.Open  = OffsetAndStride(Opens,  idx, Count, 0, Stride);
+        c.Close = OffsetAndStride(Closes, idx, Count, 0, Stride);
+        c.Low   = OffsetAndStride(Lows,   idx, Count, 0, Stride);
+        c.High  = OffsetAndStride(Highs,  idx, Count, 0, Stride);
+        c.HalfWidth = HalfWidths != NULL ? OffsetAndStride(HalfWidths, idx, Count, 0, Stride) : HalfWidth;
+        return c;
+    }
+};
+
+// Renders candles [First,First+Prims) as a wick and a body #width_percent of the candle's width each
+template <typename TTransformer>
+struct CandleRenderer {
+    inline CandleRenderer(GetterCandles getter, int first, int last, TTransformer transformer, float width_percent, float wick_weight, ImU32 col_bull, ImU32 col_bear) :
+        Getter(getter),
+        Transformer(transformer)
+    {
+        First        = first;
+        Prims        = last - first;
+        WidthPercent = width_percent;
+        HalfWick  = ImMax(wick_weight, 1.0f) * 0.5f;
+        ColBull   = col_bull;
+        ColBear   = col_bear;
+    }
+    inline void AddRect(ImDrawList& DrawList, const ImVec2& a, const ImVec2& b, ImU32 col, const ImVec2& uv) {
+        DrawList._VtxWritePtr[0].pos   = a;
+        DrawList._VtxWritePtr[0].uv    = uv;
+        DrawList._VtxWritePtr[0].col   = col;
+        DrawList._VtxWritePtr[1].pos.x = a.x;
+        DrawList._VtxWritePtr[1].pos.y = b.y;
+        DrawList._VtxWritePtr[1].uv    = uv;
+        DrawList._VtxWritePtr[1].col   = col;
+        DrawList._VtxWritePtr[2].pos   = b;
+        DrawList._VtxWritePtr[2].uv    = uv;
+        DrawList._VtxWritePtr[2].col   = col;
+        DrawList._VtxWritePtr[3].pos.x = b.x;
+        DrawList._VtxWritePtr[3].pos.y = a.y;
+        DrawList._VtxWritePtr[3].uv    = uv;
+        DrawList._VtxWritePtr[3].col   = col;
+        DrawList._VtxWritePtr += 4;
+        DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+        DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+        DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+        DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+        DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
+        DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+        DrawList._IdxWritePtr   += 6;
+        DrawList._VtxCurrentIdx += 4;
+    }
+    inline bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) {
+        const ImPlotCandle c = Getter(First + prim);
+        const double half_width = c.HalfWidth * WidthPercent;
+        const ImVec2 open  = Transformer(c.X - half_width, c.Open);
+        ImVec2       close = Transformer(c.X + half_width, c.Close);
+        const ImVec2 low   = Transformer(c.X, c.Low);
+        const ImVec2 high  = Transformer(c.X, c.High);
+        if (!cull_rect.Overlaps(ImRect(ImMin(open.x, close.x), ImMin(low.y, high.y), ImMax(open.x, close.x), ImMax(low.y, high.y))))
+            return false;
+        // keep flat candles visible
+        if (ImAbs(close.y - open.y) < 1)
+            close.y = open.y + 1;
+        const ImU32 col = c.Open > c.Close ? ColBear : ColBull;
+        AddRect(DrawList, ImVec2(low.x - HalfWick, high.y), ImVec2(low.x + HalfWick, low.y), col, uv);
+        AddRect(DrawList, open, close, col, uv);
+        return true;
+    }
+    GetterCandles Getter;
+    TTransformer Transformer;
+    int First;
+    int Prims;
+    float WidthPercent;
+    float HalfWick;
+    ImU32 ColBull;
+    ImU32 ColBear;
+    static const int IdxConsumed = 12;
+    static const int VtxConsumed = 8;
+};
+
+// Aggregates all candles into #step #unit(s) buckets: open of the first, close of the last, min low and max high.
+// Each aggregate is centered on its bucket and spans all of it, since buckets of months or years differ in length.
+inline void AggregateCandles(GetterCandles getter, ImPlotTimeUnit unit, int step, ImVector<ImPlotCandle>& out) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotCandlestick/Aggregate");
+    out.resize(0);
+    int i = 0;
+    while (i < getter.Count) {
+        ImPlotCandle c = getter(i);
+        const ImPlotTime start = FloorTimeStep(ImPlotTime::FromDouble(c.X), unit, step);
+        const double     end   = AddTime(start, unit, step).ToDouble();
+        c.X         = (start.ToDouble() + end) * 0.5;
+        c.HalfWidth = (end - start.ToDouble()) * 0.5;
+        for (++i; i < getter.Count; ++i) {
+            const ImPlotCandle n = getter(i);
+            if (n.X >= end)
+                break;
+            c.Close = n.Close;
+            c.Low   = ImMin(c.Low, n.Low);
+            c.High  = ImMax(c.High, n.High);
+        }
+        out.push_back(c);
+    }
+}
+
+template <typename Transformer>
+void RenderCandles(GetterCandles getter, Transformer transformer, ImDrawList& DrawList, float width_percent, float wick_weight, ImU32 col_bull, ImU32 col_bear) {
+    const ImPlotRange& range = GImPlot->CurrentPlot->XAxis.Range;
+    // visible candles, plus one on each side whose body may reach into the plot
+    GetterXsYs<double> get_x(getter.Xs, getter.Xs, getter.Count, 0, getter.Stride);
+    const int first = ImMax(LowerBoundX(get_x, 0, getter.Count, range.Min) - 1, 0);
+    const int last  = ImMin(LowerBoundX(get_x, first, getter.Count, range.Max) + 1, getter.Count);
+    RenderPrimitives(CandleRenderer<Transformer>(getter, first, last, transformer, width_percent, wick_weight, col_bull, col_bear), DrawList, GImPlot->BB_Plot);
+}
+
+void PlotCandlestick(const char* label_id, const double* xs, const double* opens, const double* closes, const double* lows, const double* highs, int count, float width_percent, const ImVec4& bull_col, const ImVec4& bear_col) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotCandlestick");
+    if (BeginItem(label_id)) {
+        ImPlotContext& gp = *GImPlot;
+        ImPlotItem* item = GetCurrentItem();
+        item->Color = bull_col;
+        const double pitch = count > 1 ? (xs[count - 1] - xs[0]) / (count - 1) : 1;
+        GetterCandles getter(xs, opens, closes, lows, highs, count, sizeof(double), pitch * 0.5);
+        if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
+            for (int i = 0; i < count; ++i) {
+                FitPoint(ImPlotPoint(xs[i], lows[i]));
+                FitPoint(ImPlotPoint(xs[i], highs[i]));
+            }
+        }
+        if (count > 0) {
+            // aggregate when candles are packed tighter than the minimum pitch, choosing bucket sizes like time axis ticks
+            const double sec_per_px = gp.CurrentPlot->XAxis.Range.Size() / gp.BB_Plot.GetWidth();
+            if (count > 1 && pitch < IMPLOT_CANDLE_MIN_PITCH * sec_per_px) {
+                ImPlotTimeUnit unit;
+                int step;
+                GetTimeStepForSpan(IMPLOT_CANDLE_MIN_PITCH * sec_per_px, &unit, &step);
+                ImPlotCandleCache& cache = GetCurrentItemCache(gp.CurrentPlot->CandleCaches);
+                if (!cache.Matches(xs, opens, closes, lows, highs, count, unit, step)) {
+                    cache.Xs = xs; cache.Opens = opens; cache.Closes = closes; cache.Lows = lows; cache.Highs = highs;
+                    cache.Count = count; cache.Unit = unit; cache.Step = step; cache.Valid = true;
+                    cache.FirstX = xs[0]; cache.Last = getter(count - 1);
+                    AggregateCandles(getter, unit, step, cache.Candles);
+                }
+                const ImPlotCandle* c = cache.Candles.Data;
+                getter = GetterCandles(&c->X, &c->Open, &c->Close, &c->Low, &c->High, cache.Candles.Size, sizeof(ImPlotCandle), 0, &c->HalfWidth);
+            }
+            const ImPlotItemStyle& s = GetItemStyle();
+            ImDrawList& DrawList = *GetPlotDrawList();
+            const ImU32 col_bull = ImGui::GetColorU32(bull_col);
+            const ImU32 col_bear = ImGui::GetColorU32(bear_col);
+            switch (GetCurrentScale()) {
+                case ImPlotScale_LinLin: RenderCandles(getter, TransformerLinLin(), DrawList, width_percent, s.LineWeight, col_bull, col_bear); break;
+                case ImPlotScale_LogLin: RenderCandles(getter, TransformerLogLin(), DrawList, width_percent, s.LineWeight, col_bull, col_bear); break;
+                case ImPlotScale_LinLog: RenderCandles(getter, TransformerLinLog(), DrawList, width_percent, s.LineWeight, col_bull, col_bear); break;
+                case ImPlotScale_LogLog: RenderCandles(getter, TransformerLogLog(), DrawList, width_percent, s.LineWeight, col_bull, col_bear); break;
+            }
+        }
+        EndItem();
+    }
+}
+
+void BustCandleCache(const char* label_id) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "BustCandleCache() needs to be called between BeginPlot() and EndPlot()!");
+    ImPlotCandleCache* cache = gp.CurrentPlot->CandleCaches.GetByKey(ImGui::GetID(label_id));
+    if (cache != NULL)
+        cache->Valid = false;
+}
+
 //-----------------------------------------------------------------------------
 // PLOT RECTS
 //-----------------------------------------------------------------------------
 template <typename Getter>
 void PlotRectsEx(const char* label_id, Getter getter) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotRects");
     if (BeginItem(label_id, ImPlotCol_Fill)) {
         if (FitThisFrame()) {
+            IMPLOT_PROFILE_SCOPE("ImPlot::Fit");
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(p);
@@ -1640,10 +3084,610 @@ void PlotText(const char* text, double x, double y, bool vertical, const ImVec2&
         AddTextVertical(&DrawList, pos, colTxt, text);
     }
     else {
-        ImVec2 pos = PlotToPixels(ImPlotPoint(x,y)) - ImGui::CalcTextSize(text) * 0.5f + pixel_offset;
+        ImVec2 pos = PlotToPixels(ImPlotPoint(x,y)) - CalcTextSizeCached(text) * 0.5f + pixel_offset;
         DrawList.AddText(pos, colTxt, text);
     }
     PopPlotClipRect();
 }
 
-} // namespace ImPlot
\ No newline at end of file
+//-----------------------------------------------------------------------------
+// PLOT SPARKLINES
+//-----------------------------------------------------------------------------
+
+// Maps the value indices and values of one sparkline into its cell. Unlike TransformerLinLin, it does not read the
+// current plot, so it is set up once per series and can be used outside of BeginPlot/EndPlot.
+struct TransformerSparkline {
+    TransformerSparkline() { X0 = Y0 = Mx = My = YMin = 0; }
+    TransformerSparkline(const ImPlotSparkline& spark, double y_min, double y_max) {
+        X0   = spark.CellMin.x;
+        Y0   = spark.CellMax.y;
+        Mx   = spark.Count > 1 ? (spark.CellMax.x - spark.CellMin.x) / (double)(spark.Count - 1) : 0;
+        My   = (spark.CellMax.y - spark.CellMin.y) / (y_max - y_min);
+        YMin = y_min;
+    }
+    inline ImVec2 operator()(const ImPlotPoint& p) const {
+        return ImVec2((float)(X0 + Mx * p.x), (float)(Y0 - My * (p.y - YMin)));
+    }
+    double X0, Y0, Mx, My, YMin;
+};
+
+// Renders every sparkline of a table row as one primitive stream: each segment is a fill quad down to the bottom of
+// its cell followed by a line quad. Series are set up lazily as the stream reaches them.
+struct SparklineRowRenderer {
+    SparklineRowRenderer(const ImPlotSparkline* sparklines, int count, int color_offset, float fill_alpha, float weight) :
+        Getter(NULL, 0, 0, sizeof(float))
+    {
+        Sparklines  = sparklines;
+        Count       = count;
+        ColorOffset = color_offset;
+        FillAlpha   = fill_alpha;
+        Weight      = weight;
+        Prims       = 0;
+        for (int i = 0; i < count; ++i)
+            Prims += ImMax(sparklines[i].Count - 1, 0);
+        Series = -1;
+        Seg = Segs = 0;
+    }
+    void BeginSeries(int series) {
+        const ImPlotSparkline& spark = Sparklines[series];
+        Series = series;
+        Seg    = 0;
+        Segs   = ImMax(spark.Count - 1, 0);
+        if (Segs == 0)
+            return;
+        Getter = GetterYs<float>(spark.Values, spark.Count, spark.Offset, spark.Stride);
+        double y_min = spark.YMin, y_max = spark.YMax;
+        if (y_min >= y_max) {
+            y_min = HUGE_VAL;
+            y_max = -HUGE_VAL;
+            for (int i = 0; i < spark.Count; ++i) {
+                const double y = Getter(i).y;
+                y_min = y < y_min ? y : y_min;
+                y_max = y > y_max ? y : y_max;
+            }
+            if (!(y_max > y_min)) {
+                y_min = ImNanOrInf(y_min) ? 0 : y_min - 0.5;
+                y_max = y_min + 1;
+            }
+        }
+        Transformer = TransformerSparkline(spark, y_min, y_max);
+        ImVec4 col  = IsColorAuto(spark.Color) ? GetColormapColor(ColorOffset + series) : spark.Color;
+        LineCol     = ImGui::GetColorU32(col);
+        col.w      *= FillAlpha;
+        FillCol     = ImGui::GetColorU32(col);
+        Base        = spark.CellMax.y;
+        P1          = Transformer(Getter(0));
+    }
+    inline bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int) {
+        while (Seg == Segs)
+            BeginSeries(Series + 1);
+        const ImVec2 P0 = P1;
+        const ImVec2 P2 = Transformer(Getter(++Seg));
+        P1 = P2;
+        if (!cull_rect.Overlaps(ImRect(ImMin(P0, P2), ImVec2(ImMax(P0.x, P2.x), ImMax(Base, ImMax(P0.y, P2.y))))))
+            return false;
+        DrawList._VtxWritePtr[0].pos = P0;                 DrawList._VtxWritePtr[0].uv = uv; DrawList._VtxWritePtr[0].col = FillCol;
+        DrawList._VtxWritePtr[1].pos = P2;                 DrawList._VtxWritePtr[1].uv = uv; DrawList._VtxWritePtr[1].col = FillCol;
+        DrawList._VtxWritePtr[2].pos = ImVec2(P2.x, Base); DrawList._VtxWritePtr[2].uv = uv; DrawList._VtxWritePtr[2].col = FillCol;
+        DrawList._VtxWritePtr[3].pos = ImVec2(P0.x, Base); DrawList._VtxWritePtr[3].uv = uv; DrawList._VtxWritePtr[3].col = FillCol;
+        DrawList._VtxWritePtr += 4;
+        DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+        DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+        DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
+        DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+        DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
+        DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+        DrawList._IdxWritePtr += 6;
+        DrawList._VtxCurrentIdx += 4;
+        AddLine(P0, P2, Weight, LineCol, DrawList, uv);
+        return true;
+    }
+    const ImPlotSparkline* Sparklines;
+    int                    Count;
+    int                    ColorOffset;
+    float                  FillAlpha;
+    float                  Weight;
+    int                    Prims;
+    int                    Series;
+    int                    Seg;
+    int                    Segs;
+    GetterYs<float>        Getter;
+    TransformerSparkline   Transformer;
+    ImU32                  LineCol;
+    ImU32                  FillCol;
+    float                  Base;
+    ImVec2                 P1;
+    static const int IdxConsumed = 12;
+    static const int VtxConsumed = 8;
+};
+
+void PlotSparklines(const ImPlotSparkline* sparklines, int count, float fill_alpha, ImDrawList* draw_list) {
+    IM_ASSERT_USER_ERROR(GImPlot != NULL, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot == NULL, "PlotSparklines() needs to be called outside of BeginPlot() and EndPlot()!");
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotSparklines");
+    ImPlotContext& gp = *GImPlot;
+    ImDrawList& DrawList = draw_list != NULL ? *draw_list : *ImGui::GetWindowDrawList();
+    const ImRect window_clip = ImGui::GetCurrentWindow()->InnerClipRect;
+    int first = 0;
+    while (first < count) {
+        // a row is a run of consecutive cells sharing the same vertical extent
+        ImRect row(sparklines[first].CellMin, sparklines[first].CellMax);
+        int last = first + 1;
+        while (last < count && sparklines[last].CellMin.y == row.Min.y && sparklines[last].CellMax.y == row.Max.y) {
+            row.Add(ImRect(sparklines[last].CellMin, sparklines[last].CellMax));
+            last++;
+        }
+        // rows scrolled out of view cost nothing beyond the scan above
+        row.ClipWithFull(window_clip);
+        if (row.GetWidth() > 0 && row.GetHeight() > 0) {
+            DrawList.PushClipRect(row.Min, row.Max, false);
+            RenderPrimitives(SparklineRowRenderer(sparklines + first, last - first, first, fill_alpha, gp.Style.LineWeight), DrawList, row);
+            DrawList.PopClipRect();
+        }
+        first = last;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// NEAREST POINT QUERIES
+//-----------------------------------------------------------------------------
+
+// Average number of points per cell of a hit index grid
+#define IMPLOT_HIT_CELL_POINTS 8
+// Maximum number of cells along each side of a hit index grid
+#define IMPLOT_HIT_MAX_CELLS   2048
+
+// Returns the clamped cell coordinate of #v along one side of a hit index grid
+inline int HitCellCoord(double v, const ImPlotRange& range, int cells) {
+    const double t = range.Size() > 0 ? (v - range.Min) * cells / range.Size() : 0;
+    return t <= 0 ? 0 : (t >= cells ? cells - 1 : (int)t);
+}
+
+// Checks whether xs are sorted and, if they are not, buckets the finite points into a uniform grid over their extents
+// with a two pass counting sort. The grid lives in plot space, so it stays valid as the axes are panned and zoomed.
+template <typename Getter>
+void BuildHitIndex(ImPlotHitIndex& index, Getter getter) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::FindNearestPoint/Index");
+    const int count = getter.Count;
+    index.Sorted = true;
+    double prev = -HUGE_VAL;
+    for (int i = 0; i < count && index.Sorted; ++i) {
+        const double x = getter(i).x;
+        index.Sorted = x >= prev;
+        prev = x;
+    }
+    index.Rows = index.Cols = 0;
+    index.CellStart.resize(0);
+    index.Indices.resize(0);
+    if (index.Sorted)
+        return;
+    ImPlotLimits& bounds = index.Bounds;
+    bounds.X = bounds.Y = ImPlotRange(HUGE_VAL, -HUGE_VAL);
+    for (int i = 0; i < count; ++i) {
+        const ImPlotPoint p = getter(i);
+        if (!ImNanOrInf(p.x) && !ImNanOrInf(p.y)) {
+            bounds.X.Min = ImMin(bounds.X.Min, p.x); bounds.X.Max = ImMax(bounds.X.Max, p.x);
+            bounds.Y.Min = ImMin(bounds.Y.Min, p.y); bounds.Y.Max = ImMax(bounds.Y.Max, p.y);
+        }
+    }
+    if (bounds.X.Min > bounds.X.Max)
+        return;
+    const int side  = ImClamp((int)sqrt((double)count / IMPLOT_HIT_CELL_POINTS), 1, IMPLOT_HIT_MAX_CELLS);
+    const int cells = side * side;
+    index.Rows = index.Cols = side;
+    index.CellStart.resize(cells + 1);
+    memset(index.CellStart.Data, 0, (size_t)(cells + 1) * sizeof(int));
+    for (int i = 0; i < count; ++i) {
+        const ImPlotPoint p = getter(i);
+        if (!ImNanOrInf(p.x) && !ImNanOrInf(p.y))
+            index.CellStart[HitCellCoord(p.y, bounds.Y, side) * side + HitCellCoord(p.x, bounds.X, side) + 1]++;
+    }
+    for (int c = 0; c < cells; ++c)
+        index.CellStart[c + 1] += index.CellStart[c];
+    index.Indices.resize(index.CellStart[cells]);
+    int* cursor = AllocFrame<int>(cells);
+    memcpy(cursor, index.CellStart.Data, (size_t)cells * sizeof(int));
+    for (int i = 0; i < count; ++i) {
+        const ImPlotPoint p = getter(i);
+        if (!ImNanOrInf(p.x) && !ImNanOrInf(p.y))
+            index.Indices[cursor[HitCellCoord(p.y, bounds.Y, side) * side + HitCellCoord(p.x, bounds.X, side)]++] = i;
+    }
+}
+
+template <typename T>
+int FindNearestPointEx(const char* label_id, const T* xs, const T* ys, int count, float radius, ImPlotPoint* point, int offset, int stride) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "FindNearestPoint() needs to be called between BeginPlot() and EndPlot()!");
+    const ImVec2 mouse = ImGui::GetIO().MousePos;
+    ImPlotItem* item = GetItem(label_id);
+    if (item == NULL || !item->Show || count <= 0 || !gp.BB_Plot.Contains(mouse))
+        return -1;
+    IMPLOT_PROFILE_SCOPE("ImPlot::FindNearestPoint");
+    GetterXsYs<T> getter(xs, ys, count, offset, stride);
+    ImPlotHitIndex& index = *gp.CurrentPlot->HitIndices.GetOrAddByKey(item->ID);
+    if (!index.Matches(xs, ys, count, offset, stride)) {
+        index.DataX  = xs;
+        index.DataY  = ys;
+        index.Count  = count;
+        index.Offset = offset;
+        index.Stride = stride;
+        index.Valid  = true;
+        BuildHitIndex(index, getter);
+    }
+    // only points inside the pixel square around the mouse are candidates
+    const int y_axis = GetCurrentYAxis();
+    const ImPlotPoint p0 = PixelsToPlot(mouse.x - radius, mouse.y - radius, y_axis);
+    const ImPlotPoint p1 = PixelsToPlot(mouse.x + radius, mouse.y + radius, y_axis);
+    const ImPlotRange qx(ImMin(p0.x, p1.x), ImMax(p0.x, p1.x));
+    const ImPlotRange qy(ImMin(p0.y, p1.y), ImMax(p0.y, p1.y));
+    float best_d2 = radius * radius;
+    int   best    = -1;
+    if (index.Sorted) {
+        for (int i = LowerBoundX(getter, 0, count, qx.Min); i < count; ++i) {
+            const ImPlotPoint p = getter(i);
+            if (p.x > qx.Max)
+                break;
+            const float d2 = ImLengthSqr(PlotToPixels(p, y_axis) - mouse);
+            if (d2 <= best_d2) {
+                best_d2 = d2;
+                best    = i;
+            }
+        }
+    }
+    else if (index.Rows > 0 && qx.Max >= index.Bounds.X.Min && qx.Min <= index.Bounds.X.Max && qy.Max >= index.Bounds.Y.Min && qy.Min <= index.Bounds.Y.Max) {
+        const int c0 = HitCellCoord(qx.Min, index.Bounds.X, index.Cols), c1 = HitCellCoord(qx.Max, index.Bounds.X, index.Cols);
+        const int r0 = HitCellCoord(qy.Min, index.Bounds.Y, index.Rows), r1 = HitCellCoord(qy.Max, index.Bounds.Y, index.Rows);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                const int cell = r * index.Cols + c;
+                for (int k = index.CellStart[cell]; k < index.CellStart[cell + 1]; ++k) {
+                    const int i = index.Indices[k];
+                    const float d2 = ImLengthSqr(PlotToPixels(getter(i), y_axis) - mouse);
+                    if (d2 <= best_d2) {
+                        best_d2 = d2;
+                        best    = i;
+                    }
+                }
+            }
+        }
+    }
+    if (best < 0)
+        return -1;
+    if (point != NULL)
+        *point = getter(best);
+    return ImPosMod(offset + best, count);
+}
+
+// float
+int FindNearestPoint(const char* label_id, const float* xs, const float* ys, int count, float radius, ImPlotPoint* point, int offset, int stride) {
+    return FindNearestPointEx(label_id, xs, ys, count, radius, point, offset, stride);
+}
+
+// double
+int FindNearestPoint(const char* label_id, const double* xs, const double* ys, int count, float radius, ImPlotPoint* point, int offset, int stride) {
+    return FindNearestPointEx(label_id, xs, ys, count, radius, point, offset, stride);
+}
+
+void BustHitIndex(const char* label_id) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "BustHitIndex() needs to be called between BeginPlot() and EndPlot()!");
+    ImPlotHitIndex* index = gp.CurrentPlot->HitIndices.GetByKey(ImGui::GetID(label_id));
+    if (index != NULL)
+        index->Valid = false;
+}
+
+//-----------------------------------------------------------------------------
+// QUERY SELECTION
+//-----------------------------------------------------------------------------
+
+// Running sums of a query selection
+struct QueryAccumulator {
+    ImPlotQuerySummary Summary;
+    ImPlotPoint        Sum;
+    QueryAccumulator() : Sum(0, 0) { }
+    inline void Add(double x, double y) {
+        if (Summary.Count++ == 0) {
+            Summary.Min = Summary.Max = ImPlotPoint(x, y);
+        }
+        else {
+            Summary.Min.x = ImMin(Summary.Min.x, x); Summary.Max.x = ImMax(Summary.Max.x, x);
+            Summary.Min.y = ImMin(Summary.Min.y, y); Summary.Max.y = ImMax(Summary.Max.y, y);
+        }
+        Sum.x += x;
+        Sum.y += y;
+    }
+    inline const ImPlotQuerySummary& Finish() {
+        if (Summary.Count > 0)
+            Summary.Mean = ImPlotPoint(Sum.x / Summary.Count, Sum.y / Summary.Count);
+        return Summary;
+    }
+};
+
+// Selects the points of a contiguous run of raw indices [first,last). Range tests are evaluated without branches for a
+// whole batch (which compilers can vectorize) before the selected points are accumulated.
+template <typename T>
+void QueryRun(const ImPlotLimits& rect, const T* xs, const T* ys, int first, int last, int stride, ImVector<int>* indices, QueryAccumulator& acc) {
+    const double x0 = rect.X.Min, x1 = rect.X.Max, y0 = rect.Y.Min, y1 = rect.Y.Max;
+    unsigned char mask[IMPLOT_DENSITY_BATCH];
+    for (int i = first; i < last; i += IMPLOT_DENSITY_BATCH) {
+        const int n = ImMin(IMPLOT_DENSITY_BATCH, last - i);
+        for (int j = 0; j < n; ++j) {
+            const double x = HistogramSample(xs, i + j, stride);
+            const double y = HistogramSample(ys, i + j, stride);
+            mask[j] = (unsigned char)((x >= x0) & (x <= x1) & (y >= y0) & (y <= y1));
+        }
+        for (int j = 0; j < n; ++j) {
+            if (mask[j]) {
+                acc.Add(HistogramSample(xs, i + j, stride), HistogramSample(ys, i + j, stride));
+                if (indices != NULL)
+                    indices->push_back(i + j);
+            }
+        }
+    }
+}
+
+// Returns the first index in [first,last) whose x is greater than #x (xs must be sorted in ascending order)
+template <typename Getter>
+inline int UpperBoundX(Getter& getter, int first, int last, double x) {
+    while (first < last) {
+        const int mid = first + (last - first) / 2;
+        if (getter(mid).x <= x)
+            first = mid + 1;
+        else
+            last = mid;
+    }
+    return first;
+}
+
+template <typename T>
+ImPlotQuerySummary QueryPointsEx(const ImPlotLimits& rect, const T* xs, const T* ys, int count, ImVector<int>* indices, bool sorted_x, int offset, int stride) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::QueryPoints");
+    QueryAccumulator acc;
+    if (count <= 0)
+        return acc.Summary;
+    // logical range of candidates, narrowed to the x bounds if xs are sorted
+    int lo = 0, hi = count;
+    if (sorted_x) {
+        GetterXsYs<T> getter(xs, ys, count, offset, stride);
+        lo = LowerBoundX(getter, 0, count, rect.X.Min);
+        hi = UpperBoundX(getter, lo, count, rect.X.Max);
+    }
+    // ring buffers are scanned as (at most) two runs of raw indices, preserving the logical order
+    const int start = ImPosMod(offset + lo, count);
+    const int size  = hi - lo;
+    if (start + size <= count) {
+        QueryRun(rect, xs, ys, start, start + size, stride, indices, acc);
+    }
+    else {
+        QueryRun(rect, xs, ys, start, count, stride, indices, acc);
+        QueryRun(rect, xs, ys, 0, start + size - count, stride, indices, acc);
+    }
+    return acc.Finish();
+}
+
+// float
+ImPlotQuerySummary QueryPoints(const ImPlotLimits& rect, const float* xs, const float* ys, int count, ImVector<int>* indices, bool sorted_x, int offset, int stride) {
+    return QueryPointsEx(rect, xs, ys, count, indices, sorted_x, offset, stride);
+}
+
+// double
+ImPlotQuerySummary QueryPoints(const ImPlotLimits& rect, const double* xs, const double* ys, int count, ImVector<int>* indices, bool sorted_x, int offset, int stride) {
+    return QueryPointsEx(rect, xs, ys, count, indices, sorted_x, offset, stride);
+}
+
+template <typename T>
+ImPlotQuerySummary QueryPointsRangeEx(const ImPlotLimits& rect, const T* xs, const T* ys, int begin, int end, ImVector<int>* indices, int stride) {
+    QueryAccumulator acc;
+    QueryRun(rect, xs, ys, begin, end, stride, indices, acc);
+    return acc.Finish();
+}
+
+// float
+ImPlotQuerySummary QueryPointsRange(const ImPlotLimits& rect, const float* xs, const float* ys, int begin, int end, ImVector<int>* indices, int stride) {
+    return QueryPointsRangeEx(rect, xs, ys, begin, end, indices, stride);
+}
+
+// double
+ImPlotQuerySummary QueryPointsRange(const ImPlotLimits& rect, const double* xs, const double* ys, int begin, int end, ImVector<int>* indices, int stride) {
+    return QueryPointsRangeEx(rect, xs, ys, begin, end, indices, stride);
+}
+
+ImPlotQuerySummary MergeQuerySummaries(const ImPlotQuerySummary& a, const ImPlotQuerySummary& b) {
+    if (a.Count == 0)
+        return b;
+    if (b.Count == 0)
+        return a;
+    ImPlotQuerySummary m;
+    m.Count  = a.Count + b.Count;
+    m.Min    = ImPlotPoint(ImMin(a.Min.x, b.Min.x), ImMin(a.Min.y, b.Min.y));
+    m.Max    = ImPlotPoint(ImMax(a.Max.x, b.Max.x), ImMax(a.Max.y, b.Max.y));
+    m.Mean.x = (a.Mean.x * a.Count + b.Mean.x * b.Count) / m.Count;
+    m.Mean.y = (a.Mean.y * a.Count + b.Mean.y * b.Count) / m.Count;
+    return m;
+}
+
+//-----------------------------------------------------------------------------
+// MICRO-BENCHMARKS
+//-----------------------------------------------------------------------------
+
+#ifdef IMPLOT_ENABLE_BENCHMARKS
+
+// Accumulates getter/transformer results so the benchmarked loops can't be optimized away
+static volatile double GBenchSink = 0;
+
+// Draw list sizes before a benchmark case, used to discard the geometry it emitted
+struct BenchDrawListCheckpoint {
+    BenchDrawListCheckpoint(ImDrawList& DrawList) {
+        CmdCount      = DrawList.CmdBuffer.Size;
+        ElemCount     = CmdCount > 0 ? DrawList.CmdBuffer.back().ElemCount : 0;
+        VtxCount      = DrawList.VtxBuffer.Size;
+        IdxCount      = DrawList.IdxBuffer.Size;
+        VtxCurrentIdx = DrawList._VtxCurrentIdx;
+    }
+    void Restore(ImDrawList& DrawList) const {
+        DrawList.CmdBuffer.shrink(CmdCount);
+        if (CmdCount > 0)
+            DrawList.CmdBuffer.back().ElemCount = ElemCount;
+        DrawList.VtxBuffer.shrink(VtxCount);
+        DrawList.IdxBuffer.shrink(IdxCount);
+        DrawList._VtxWritePtr   = DrawList.VtxBuffer.Data + VtxCount;
+        DrawList._IdxWritePtr   = DrawList.IdxBuffer.Data + IdxCount;
+        DrawList._VtxCurrentIdx = VtxCurrentIdx;
+    }
+    int          CmdCount;
+    unsigned int ElemCount;
+    int          VtxCount;
+    int          IdxCount;
+    unsigned int VtxCurrentIdx;
+};
+
+template <typename Getter>
+struct BenchGetterCase {
+    BenchGetterCase(const Getter& getter) : G(getter) { }
+    void operator()() {
+        double acc = 0;
+        for (int i = 0; i < G.Count; ++i) {
+            ImPlotPoint p = G(i);
+            acc += p.x + p.y;
+        }
+        GBenchSink += acc;
+    }
+    Getter G;
+};
+
+template <typename Getter, typename Transformer>
+struct BenchTransformerCase {
+    BenchTransformerCase(const Getter& getter) : G(getter) { }
+    void operator()() {
+        Transformer transformer;
+        float acc = 0;
+        for (int i = 0; i < G.Count; ++i) {
+            ImVec2 p = transformer(G(i));
+            acc += p.x + p.y;
+        }
+        GBenchSink += acc;
+    }
+    Getter G;
+};
+
+template <typename Renderer>
+struct BenchRendererCase {
+    BenchRendererCase(const Renderer& renderer) : R(renderer) { }
+    void operator()() {
+        ImDrawList& DrawList = *GetPlotDrawList();
+        BenchDrawListCheckpoint checkpoint(DrawList);
+        RenderPrimitives(R, DrawList, GImPlot->BB_Plot);
+        checkpoint.Restore(DrawList);
+    }
+    Renderer R;
+};
+
+template <typename Getter>
+struct BenchMarkerCase {
+    BenchMarkerCase(const Getter& getter, ImPlotMarker marker) : G(getter), Marker(marker) { }
+    void operator()() {
+        ImDrawList& DrawList = *GetPlotDrawList();
+        BenchDrawListCheckpoint checkpoint(DrawList);
+        RenderMarkers(G, TransformerLinLin(), DrawList, Marker, 4, true, IM_COL32_WHITE, 1, true, IM_COL32_WHITE);
+        checkpoint.Restore(DrawList);
+    }
+    Getter G;
+    ImPlotMarker Marker;
+};
+
+// Times the best of #repeats runs of #bench and appends the result to #json_out
+template <typename Case>
+void RunBenchCase(ImGuiTextBuffer* json_out, bool* first, const char* kind, const char* name, const char* layout, int stride, int offset, int count, int repeats, Case bench) {
+    double best_ms = 0;
+    for (int r = 0; r < repeats; ++r) {
+        const double t0 = GetPerfTimeMs();
+        bench();
+        const double ms = GetPerfTimeMs() - t0;
+        best_ms = r == 0 ? ms : ImMin(best_ms, ms);
+    }
+    json_out->appendf("%s\n    { \"kind\": \"%s\", \"name\": \"%s\", \"layout\": \"%s\", \"stride\": %d, \"offset\": %d, \"count\": %d, \"ns_per_point\": %.4f }",
+                      *first ? "" : ",", kind, name, layout, stride, offset, count, best_ms * 1000000.0 / count);
+    *first = false;
+}
+
+static ImPlotPoint BenchGetPoint(void* data, int idx) {
+    return ((ImPlotPoint*)data)[idx];
+}
+
+void RunItemMicroBenchmarks(ImGuiTextBuffer* json_out, int max_points, int repeats) {
+    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != NULL, "RunItemMicroBenchmarks() needs to be called between BeginPlot() and EndPlot()!");
+    IM_ASSERT(json_out != NULL && max_points > 1 && repeats > 0);
+    static const int   sizes[]   = { 1000, 100000, 1000000 };
+    static const char* layouts[] = { "contiguous", "strided", "ring", "ring_strided" };
+
+    // separate arrays, interleaved x/y arrays (stride of two elements) and ImPlotPoints, all holding the same data
+    const int n = ImMin(max_points, sizes[IM_ARRAYSIZE(sizes)-1]);
+    ImVector<double> xs_d, ys_d, xys_d;
+    ImVector<float>  xs_f, ys_f, xys_f;
+    ImVector<ImPlotPoint> pts;
+    xs_d.resize(n); ys_d.resize(n); xys_d.resize(2*n);
+    xs_f.resize(n); ys_f.resize(n); xys_f.resize(2*n);
+    pts.resize(n);
+    for (int i = 0; i < n; ++i) {
+        const double x = i + 1;
+        const double y = 0.55 + 0.45 * sin(i * 0.01); // positive so the log transformers are valid
+        xs_d[i] = xys_d[2*i] = x;        ys_d[i] = xys_d[2*i+1] = y;
+        xs_f[i] = xys_f[2*i] = (float)x; ys_f[i] = xys_f[2*i+1] = (float)y;
+        pts[i]  = ImPlotPoint(x, y);
+    }
+
+    json_out->append("[");
+    bool first = true;
+    for (int s = 0; s < IM_ARRAYSIZE(sizes); ++s) {
+        const int count = sizes[s];
+        if (count > max_points)
+            continue;
+        for (int l = 0; l < IM_ARRAYSIZE(layouts); ++l) {
+            const bool    strided  = (l & 1) != 0;
+            const int     offset   = (l & 2) != 0 ? count / 3 : 0;
+            const int     stride_d = strided ? 2 * (int)sizeof(double) : (int)sizeof(double);
+            const int     stride_f = strided ? 2 * (int)sizeof(float)  : (int)sizeof(float);
+            const double* xd       = strided ? xys_d.Data : xs_d.Data;
+            const double* yd       = strided ? xys_d.Data + 1 : ys_d.Data;
+            const float*  xf       = strided ? xys_f.Data : xs_f.Data;
+            const float*  yf       = strided ? xys_f.Data + 1 : ys_f.Data;
+            const char*   layout   = layouts[l];
+            GetterXsYs<double>    getter(xd, yd, count, offset, stride_d);
+            GetterXsYRef<double>  getter_ref(xd, 0.1, count, offset, stride_d);
+            // getters
+            RunBenchCase(json_out, &first, "getter", "GetterYs<float>",     layout, stride_f, offset, count, repeats, BenchGetterCase<GetterYs<float> >(GetterYs<float>(yf, count, offset, stride_f)));
+            RunBenchCase(json_out, &first, "getter", "GetterYs<double>",    layout, stride_d, offset, count, repeats, BenchGetterCase<GetterYs<double> >(GetterYs<double>(yd, count, offset, stride_d)));
+            RunBenchCase(json_out, &first, "getter", "GetterXsYs<float>",   layout, stride_f, offset, count, repeats, BenchGetterCase<GetterXsYs<float> >(GetterXsYs<float>(xf, yf, count, offset, stride_f)));
+            RunBenchCase(json_out, &first, "getter", "GetterXsYs<double>",  layout, stride_d, offset, count, repeats, BenchGetterCase<GetterXsYs<double> >(getter));
+            if (!strided) {
+                RunBenchCase(json_out, &first, "getter", "GetterImPlotPoint",        layout, (int)sizeof(ImPlotPoint), offset, count, repeats, BenchGetterCase<GetterImPlotPoint>(GetterImPlotPoint(pts.Data, count, offset)));
+                RunBenchCase(json_out, &first, "getter", "GetterFuncPtrImPlotPoint", layout, (int)sizeof(ImPlotPoint), offset, count, repeats, BenchGetterCase<GetterFuncPtrImPlotPoint>(GetterFuncPtrImPlotPoint(BenchGetPoint, pts.Data, count, offset)));
+            }
+            // transformers
+            RunBenchCase(json_out, &first, "transformer", "TransformerLinLin", layout, stride_d, offset, count, repeats, BenchTransformerCase<GetterXsYs<double>, TransformerLinLin>(getter));
+            RunBenchCase(json_out, &first, "transformer", "TransformerLogLin", layout, stride_d, offset, count, repeats, BenchTransformerCase<GetterXsYs<double>, TransformerLogLin>(getter));
+            RunBenchCase(json_out, &first, "transformer", "TransformerLinLog", layout, stride_d, offset, count, repeats, BenchTransformerCase<GetterXsYs<double>, TransformerLinLog>(getter));
+            RunBenchCase(json_out, &first, "transformer", "TransformerLogLog", layout, stride_d, offset, count, repeats, BenchTransformerCase<GetterXsYs<double>, TransformerLogLog>(getter));
+            // renderers
+            typedef LineStripRenderer<GetterXsYs<double>, TransformerLinLin> LineStrip;
+            typedef LineStripRendererAA<GetterXsYs<double>, TransformerLinLin> LineStripAA;
+            typedef LineStripJoinRenderer<GetterXsYs<double>, TransformerLinLin, false> LineStripMiter;
+            typedef LineStripJoinRenderer<GetterXsYs<double>, TransformerLinLin, true> LineStripBevel;
+            typedef ShadedRenderer<GetterXsYs<double>, GetterXsYRef<double>, TransformerLinLin> Shaded;
+            typedef RectRenderer<GetterXsYs<double>, TransformerLinLin> Rects;
+            RunBenchCase(json_out, &first, "renderer", "LineStripRenderer",    layout, stride_d, offset, count, repeats, BenchRendererCase<LineStrip>(LineStrip(getter, TransformerLinLin(), IM_COL32_WHITE, 1)));
+            RunBenchCase(json_out, &first, "renderer", "LineStripRendererAA",  layout, stride_d, offset, count, repeats, BenchRendererCase<LineStripAA>(LineStripAA(getter, TransformerLinLin(), IM_COL32_WHITE, 1)));
+            RunBenchCase(json_out, &first, "renderer", "LineStripMiter",       layout, stride_d, offset, count, repeats, BenchRendererCase<LineStripMiter>(LineStripMiter(getter, TransformerLinLin(), IM_COL32_WHITE, 1)));
+            RunBenchCase(json_out, &first, "renderer", "LineStripBevel",       layout, stride_d, offset, count, repeats, BenchRendererCase<LineStripBevel>(LineStripBevel(getter, TransformerLinLin(), IM_COL32_WHITE, 1)));
+            RunBenchCase(json_out, &first, "renderer", "ShadedRenderer",       layout, stride_d, offset, count, repeats, BenchRendererCase<Shaded>(Shaded(getter, getter_ref, TransformerLinLin(), IM_COL32_WHITE)));
+            RunBenchCase(json_out, &first, "renderer", "RectRenderer",         layout, stride_d, offset, count, repeats, BenchRendererCase<Rects>(Rects(getter, TransformerLinLin(), IM_COL32_WHITE)));
+            RunBenchCase(json_out, &first, "renderer", "MarkerCircle",         layout, stride_d, offset, count, repeats, BenchMarkerCase<GetterXsYs<double> >(getter, ImPlotMarker_Circle));
+            RunBenchCase(json_out, &first, "renderer", "MarkerSquare",         layout, stride_d, offset, count, repeats, BenchMarkerCase<GetterXsYs<double> >(getter, ImPlotMarker_Square));
+        }
+    }
+    json_out->append("\n  ]");
+}
+
+#endif // #ifdef IMPLOT_ENABLE_BENCHMARKS
+
+} // namespace ImPlot